@@ -668,13 +668,7 @@ namespace core {
     virtual void sxhash_(HashGenerator& hg) const final {this->ranged_sxhash(hg,0,this->length());}
     virtual void ranged_sxhash(HashGenerator& hg, size_t start, size_t end) const final {
       if (hg.isFilling()) {
-        Fixnum hash = 5381;
-        Fixnum c;
-        for ( size_t i(start); i<end; ++i ) {
-          const value_type& c = (*this)[i];
-          hash = ((hash << 5) + hash) + c;
-        }
-        hg.addPart(hash);
+        hg.addPart((Fixnum)hash_string_chars(this->begin()+start,end-start));
       }
     }
   };
@@ -747,13 +741,7 @@ namespace core {
     virtual void sxhash_(HashGenerator& hg) const override {this->ranged_sxhash(hg,0,this->length());}
     virtual void ranged_sxhash(HashGenerator& hg, size_t start, size_t end) const override {
       if (hg.isFilling()) {
-        Fixnum hash = 5381;
-        Fixnum c;
-        for ( size_t i(start); i<end; ++i ) {
-          const value_type& c = (*this)[i];
-          hash = ((hash << 5) + hash) + c;
-        }
-        hg.addPart(hash);
+        hg.addPart((Fixnum)hash_string_chars(this->begin()+start,end-start));
       }
     }
   };
@@ -1891,6 +1879,12 @@ CL_DOCSTRING("copy_subarray");
   size_t SimpleBitVector_lowestIndex(SimpleBitVector_sp x);
   bool SimpleBitVector_isZero(SimpleBitVector_sp x);
   SimpleBitVector_sp SimpleBitVector_copy(SimpleBitVector_sp orig_sbv);
+
+  // Word at a time scans over bit ranges of SimpleBitVector_O data - see bits.cc
+  size_t bit_array_count(const SimpleBitVector_O::value_type* words, size_t start, size_t end);
+  gc::Fixnum bit_array_position(const SimpleBitVector_O::value_type* words, size_t start, size_t end, uint bit, bool from_end);
+  bool bit_array_equal(const SimpleBitVector_O::value_type* x, size_t startx, const SimpleBitVector_O::value_type* y, size_t starty, size_t len);
+  void bit_array_fill(SimpleBitVector_O::value_type* words, size_t start, size_t end, uint bit);
   
 };
 
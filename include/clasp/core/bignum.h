@@ -60,7 +60,7 @@ public: // Functions here
     return b;
   };
 
-  static Bignum_sp create( mpz_class v )
+  static Bignum_sp create( const mpz_class& v )
   {
     GC_ALLOCATE(Bignum_O, b);
     b->_value = v;
@@ -261,7 +261,7 @@ namespace core {
   Integer_mv big_floor(Bignum_sp a, Bignum_sp b);
 
   inline Integer_sp _clasp_big_register_normalize(Bignum_sp x) {
-    return Integer_O::create(x->get());
+    return Integer_O::create(x->ref());
   }
 
   inline Integer_sp _clasp_big_floor(Bignum_sp a, Bignum_sp b, Real_sp *rP) {
@@ -288,6 +288,19 @@ namespace core {
 
   Integer_sp _clasp_big_gcd(Bignum_sp x, Bignum_sp y);
 
+  /*! Integer arithmetic that computes into the thread's bignum registers
+      so that GMP reuses their limbs, only a result that doesn't fit in a
+      fixnum allocates (once, for the Bignum_O that holds it). */
+  Integer_sp _clasp_fix_plus_fix(Fixnum x, Fixnum y);
+  Integer_sp _clasp_fix_minus_fix(Fixnum x, Fixnum y);
+  Integer_sp _clasp_fix_times_fix(Fixnum x, Fixnum y);
+  Integer_sp _clasp_big_plus_fix(const Bignum &x, Fixnum y);
+  Integer_sp _clasp_fix_minus_big(Fixnum x, const Bignum &y);
+  Integer_sp _clasp_big_times_fix(const Bignum &x, Fixnum y);
+  Integer_sp _clasp_big_plus_big(const Bignum &x, const Bignum &y);
+  Integer_sp _clasp_big_minus_big(const Bignum &x, const Bignum &y);
+  Integer_sp _clasp_big_times_big(const Bignum &x, const Bignum &y);
+
 #define CLASP_BIGNUM_SIZE(x) ((x)->_mp_size)
 #define CLASP_BIGNUM_ABS_SIZE(x) \
   (CLASP_BIGNUM_SIZE(x) < 0 ? -CLASP_BIGNUM_SIZE(x) : CLASP_BIGNUM_SIZE(x))
@@ -98,7 +98,10 @@ void c_btcl();
 int safe_backtrace(void**& return_buffer);
 
 bool lookup_stack_map_entry(uintptr_t functionPointer, int& frameOffset, int& frameSize);
-void register_jitted_object(const std::string& name, uintptr_t address, int size);
+void register_jitted_object(const std::string& name, uintptr_t address, int size, void* owner=NULL);
+void unregister_jitted_objects(void* owner);
+bool lookup_jitted_object(uintptr_t address, std::string& name, uintptr_t& start, size_t& size);
+bool lookup_jitted_object_named(const std::string& name, uintptr_t& start, size_t& size);
 
 void push_one_llvm_stackmap(bool jit, uintptr_t& startAddress );
 
@@ -106,6 +109,11 @@ void register_llvm_stackmaps(uintptr_t startAddress, uintptr_t endAddress, size_
 
  bool if_dynamic_library_loaded_remove(const std::string& libraryName);
 
+/*! Forget the cached per-library symbol indices - call after dlopen/dlclose */
+void invalidate_library_symbol_indices();
+/*! Find the function symbol in a loaded library that contains address */
+bool lookup_library_function(uintptr_t address, std::string& name, uintptr_t& start);
+
 void add_dynamic_library_handle(const std::string& libraryName, void* handle);
 
 
@@ -72,10 +72,12 @@ namespace core {
       , _CallHistory(_Nil<T_O>())
       , _SpecializerProfile(_Nil<T_O>())
 //      _Lock(mp::SharedMutex_O::make_shared_mutex(_Nil<T_O>())),
-      , _CompiledDispatchFunction(_Nil<T_O>()) {};
+      , _CompiledDispatchFunction(_Nil<T_O>())
+      , _InterpretedDispatcher(_Nil<T_O>()) {};
     explicit FuncallableInstance_O(FunctionDescription* fdesc,Instance_sp metaClass, size_t slots) :
     Base(not_funcallable_entry_point),
       _Class(metaClass)
+      ,_isgf(CLASP_NOT_FUNCALLABLE)
       ,_DebugOn(false)
       ,_Sig(_Unbound<T_O>())
       ,_FunctionDescription(fdesc)
@@ -83,6 +85,7 @@ namespace core {
       ,_SpecializerProfile(_Nil<T_O>())
 //      ,_Lock(mp::SharedMutex_O::make_shared_mutex(_Nil<T_O>()))
       , _CompiledDispatchFunction(_Nil<T_O>())
+      , _InterpretedDispatcher(_Nil<T_O>())
     {};
     virtual ~FuncallableInstance_O(){};
   public:
@@ -98,7 +101,10 @@ namespace core {
     gc::atomic_wrapper<T_sp>   _SpecializerProfile;
 //    T_sp   _Lock;
     gc::atomic_wrapper<T_sp>   _CompiledDispatchFunction;
-    int    _isgf;
+    // The interpreted dispatch tree used until a dispatcher is compiled (see closfastgf.lsp)
+    gc::atomic_wrapper<T_sp>   _InterpretedDispatcher;
+    // Written before the entry point is published (release), read with acquire
+    std::atomic<int> _isgf;
     bool   _DebugOn;
   public:
   public:
@@ -123,6 +129,9 @@ namespace core {
 //    void GFUN_LOCK_set(T_sp l) { this->_Lock = l; };
     T_sp GFUN_DISPATCHER() const { return this->_CompiledDispatchFunction.load(); };
     void GFUN_DISPATCHER_set(T_sp val) { this->_CompiledDispatchFunction.store(val); };
+    bool GFUN_DISPATCHER_compare_exchange(T_sp call_history, Function_sp dispatcher);
+    T_sp GFUN_INTERPRETED_DISPATCHER() const { return this->_InterpretedDispatcher.load(); };
+    T_sp GFUN_INTERPRETED_DISPATCHER_compare_exchange(T_sp expected, T_sp new_value);
   public:
 
     void accumulateSuperClasses(HashTableEq_sp supers, VectorObjects_sp arrayedSupers, Instance_sp mc);
@@ -165,7 +174,7 @@ namespace core {
     void stamp_set(Fixnum s);
     size_t numberOfSlots() const;
 
-    CL_DEFMETHOD int isgf() const { return this->_isgf; };
+    CL_DEFMETHOD int isgf() const { return this->_isgf.load(std::memory_order_acquire); };
 
     Instance_sp _instanceClass() const { return this->_Class; };
 
@@ -27,6 +27,7 @@ THE SOFTWARE.
 #ifndef _core_HashTable_H
 #define _core_HashTable_H
 
+#include <atomic>
 #include <clasp/core/object.h>
 #include <clasp/core/record.h>
 #include <clasp/core/array.h>
@@ -34,15 +35,14 @@ THE SOFTWARE.
 #include <clasp/core/corePackage.fwd.h>
 
 namespace core {
-  T_sp cl__make_hash_table(T_sp test, Fixnum_sp size, Number_sp rehash_size, Real_sp orehash_threshold, Symbol_sp weakness = _Nil<T_O>(), T_sp debug = _Nil<T_O>(), T_sp thread_safe = _Nil<T_O>());
+  T_sp cl__make_hash_table(T_sp test, Fixnum_sp size, Number_sp rehash_size, Real_sp orehash_threshold, Symbol_sp weakness = _Nil<T_O>(), T_sp debug = _Nil<T_O>(), T_sp thread_safe = _Nil<T_O>(), T_sp concurrency = _Nil<T_O>());
 
 
 
   FORWARD(HashTable);
   class HashTable_O : public General_O {
     struct metadata_bootstrap_class {};
-    friend T_sp cl__make_hash_table(T_sp test, Fixnum_sp size, Number_sp rehash_size, Real_sp orehash_threshold, Symbol_sp weakness, T_sp debug, T_sp thread_safe);
-    friend class HashTableReadLock;
+    friend T_sp cl__make_hash_table(T_sp test, Fixnum_sp size, Number_sp rehash_size, Real_sp orehash_threshold, Symbol_sp weakness, T_sp debug, T_sp thread_safe, T_sp concurrency);
     friend class HashTableWriteLock;
     LISP_CLASS(core, ClPkg, HashTable_O, "HashTable",core::General_O);
     bool fieldsp() const { return true; };
@@ -53,7 +53,7 @@ namespace core {
 #ifdef DEBUG_REHASH_COUNT
     _RehashCount(0),
 #endif
-      _RehashSize(_Nil<Number_O>()), _RehashThreshold(1.2), _HashTable(_Nil<VectorObjects_O>()), _HashTableCount(0)
+      _RehashSize(_Nil<Number_O>()), _RehashThreshold(1.0), _HashTable(_Nil<SimpleVector_O>()), _HashTableCount(0), _HashTableDeleted(0), _Shards(_Nil<SimpleVector_O>())
     {};
     virtual ~HashTable_O(){};
   //	DEFAULT_CTOR_DTOR(HashTable_O);
@@ -64,14 +64,46 @@ namespace core {
     friend T_mv cl__maphash(T_sp function_desig, HashTable_sp hash_table);
     friend T_sp cl__clrhash(HashTable_sp hash_table);
 
+  public:
+  /*! The table is open addressed: entries are stored inline in _HashTable,
+      EntryStride slots per entry laid out as [hash key value].  The number of
+      entries (the capacity) is always a power of two and collisions are resolved
+      by linear probing.  An empty entry has an unbound key; remhash leaves a
+      deleted key behind (a tombstone) so that probe sequences running through
+      it stay intact.  The full hash is kept as a fixnum so that probing can
+      reject most mismatches without calling keyTest and so that growing the
+      table does not need to rehash the keys.
+
+      Readers take no lock.  Writers are serialized by _Mutex (for thread-safe
+      tables) and publish their changes so that a reader racing with them sees
+      either the old or the new entry:  a new entry stores its hash and value
+      before its key (release), a rehash fills a fresh vector and then swaps
+      it into _HashTable (release) and never touches the old one again.
+      Readers load slots with acquire and re-check the key after reading the
+      value, and a lookup that misses is retried if _HashTable was swapped
+      while it probed.  The collector keeps retired vectors alive for as
+      long as a reader still holds them. */
+    static const size_t EntryStride = 3;
+    static const size_t HashOffset = 0;
+    static const size_t KeyOffset = 1;
+    static const size_t ValueOffset = 2;
+  /*! Open addressing needs free entries to terminate probes, so the
+      rehash-threshold is capped at this load factor */
+    static constexpr double MaxLoadFactor = 0.75;
   public: // instance variables here
 #ifdef DEBUG_REHASH_COUNT
     size_t    _RehashCount;
 #endif
     Number_sp _RehashSize;
     double _RehashThreshold;
-    VectorObjects_sp _HashTable;
+    SimpleVector_sp _HashTable;
     uint _HashTableCount;
+    uint _HashTableDeleted;
+  /*! A table made with :concurrency n spreads its entries over n shards,
+      each an independently locked table with the same test, chosen by the
+      high bits of the key's hash.  A sharded table keeps nothing in its own
+      _HashTable - every operation is forwarded to the shards. */
+    SimpleVector_sp _Shards;
 #ifdef CLASP_THREADS
     mutable mp::SharedMutex_sp _Mutex;
 #endif
@@ -95,13 +127,16 @@ namespace core {
     void setup(uint sz, Number_sp rehashSize, double rehashThreshold);
     uint resizeEmptyTable_no_lock(size_t sz);
     uint calculateHashTableCount() const;
+    double maxLoadFactor() const;
+    static SimpleVector_sp makeEmptyTable(size_t sz);
+    size_t insertEntry_no_lock(SimpleVector_O &table, gc::Fixnum hash, T_sp key, T_sp value);
 
   public:
-  /*! If findKey is defined then search it as you rehash and return resulting keyValuePair CONS */
-    List_sp rehash_no_lock(bool expandTable, T_sp findKey);
-    List_sp rehash(bool expandTable, T_sp findKey);
+  /*! If findKey is defined then search it as you rehash and return the index of its entry (or -1) */
+    gc::Fixnum rehash_no_lock(bool expandTable, T_sp findKey);
+    gc::Fixnum rehash(bool expandTable, T_sp findKey);
     CL_LISPIFY_NAME("hash-table-buckets");
-    CL_DEFMETHOD VectorObjects_sp hash_table_buckets() const { return this->_HashTable; };
+    CL_DEFMETHOD SimpleVector_sp hash_table_buckets() const { return this->_HashTable; };
     CL_LISPIFY_NAME("hash-table-shared-mutex");
     CL_DEFMETHOD T_sp hash_table_shared_mutex() const { if (this->_Mutex) return this->_Mutex; else return _Nil<T_O>(); };
     void set_thread_safe(bool thread_safe);
@@ -121,16 +156,82 @@ namespace core {
     }
     virtual bool keyTest(T_sp entryKey, T_sp searchKey) const;
 
-  /*! I'm not sure I need this and tableRef */
-    List_sp bucketsFind_no_lock(T_sp key) const;
-  /*! I'm not sure I need this and bucketsFind */
-    virtual List_sp tableRef_no_lock(T_sp key);
-    List_sp findAssoc_no_lock(gc::Fixnum index, T_sp searchKey) const;
+    bool shardedp() const { return this->_Shards.notnilp(); };
+    HashTable_sp shardFor(T_sp key) const {
+      // The shards index their entries with the low bits of the same hash
+      gc::Fixnum hash = this->entryHash(key, false);
+      return gc::As_unsafe<HashTable_sp>((*this->_Shards)[(hash >> 32) % this->_Shards->length()]);
+    }
+    HashTable_sp shard(size_t index) const { return gc::As_unsafe<HashTable_sp>((*this->_Shards)[index]); };
+
+    static T_sp loadSlot(T_sp &slot) {
+      std::atomic<T_O*>& as_atomic = reinterpret_cast<std::atomic<T_O*>&>(slot.rawRef_());
+      return T_sp((gctools::Tagged)as_atomic.load(std::memory_order_acquire));
+    }
+    static void storeSlot(T_sp &slot, T_sp val) {
+      std::atomic<T_O*>& as_atomic = reinterpret_cast<std::atomic<T_O*>&>(slot.rawRef_());
+      as_atomic.store(val.raw_(), std::memory_order_release);
+    }
+    SimpleVector_sp loadTable() const {
+      std::atomic<SimpleVector_O*>& as_atomic = reinterpret_cast<std::atomic<SimpleVector_O*>&>(const_cast<SimpleVector_sp&>(this->_HashTable).rawRef_());
+      return SimpleVector_sp((gctools::Tagged)as_atomic.load(std::memory_order_acquire));
+    }
+    void storeTable(SimpleVector_sp table) {
+      std::atomic<SimpleVector_O*>& as_atomic = reinterpret_cast<std::atomic<SimpleVector_O*>&>(this->_HashTable.rawRef_());
+      as_atomic.store(table.raw_(), std::memory_order_release);
+    }
+  /*! Read the entry at index of table without locking.
+      Return false if it is empty, deleted or was removed while reading it. */
+    static bool readEntry(SimpleVector_O &table, size_t index, T_sp &key, T_sp &value) {
+      T_sp *entry = &table[index * EntryStride];
+      key = loadSlot(entry[KeyOffset]);
+      if (key.unboundp() || key.deletedp()) return false;
+      value = loadSlot(entry[ValueOffset]);
+      return !value.unboundp() && loadSlot(entry[KeyOffset]).raw_() == key.raw_();
+    }
+
+  /*! Return the full (unbounded) hash of key as stored in the table */
+    gc::Fixnum entryHash(T_sp key, bool willAddKey) const {
+      return this->safe_sxhashKey(key, 0, willAddKey) & gc::most_positive_fixnum;
+    }
+    size_t tableCapacity() const { return this->_HashTable->length() / EntryStride; };
+    T_sp& entryKey(size_t index) const { return (*this->_HashTable)[index * EntryStride + KeyOffset]; };
+    T_sp& entryValue(size_t index) const { return (*this->_HashTable)[index * EntryStride + ValueOffset]; };
+
+  /*! Probe table for key starting from its home entry.
+      Return the entry index and set value, or return -1 */
+    template <class KeyTest>
+      static gc::Fixnum probe(SimpleVector_O &table, T_sp key, gc::Fixnum hash, KeyTest test, T_sp &value) {
+      size_t mask = table.length() / EntryStride - 1;
+      size_t index = hash & mask;
+      for (size_t probes(0); probes <= mask; ++probes) {
+        T_sp *entry = &table[index * EntryStride];
+        T_sp probeKey = loadSlot(entry[KeyOffset]);
+        if (probeKey.unboundp()) break;
+        if (!probeKey.deletedp() && entry[HashOffset].unsafe_fixnum() == hash && test(probeKey, key)) {
+          value = loadSlot(entry[ValueOffset]);
+          // If the entry was removed while we looked at it the key is gone
+          if (value.unboundp() || loadSlot(entry[KeyOffset]).raw_() != probeKey.raw_()) return -1;
+          return index;
+        }
+        index = (index + 1) & mask;
+      }
+      return -1;
+    }
+  /*! Return the index of the entry for key in table given its hash and set value, or return -1 */
+    virtual gc::Fixnum findEntry(SimpleVector_O &table, T_sp key, gc::Fixnum hash, T_sp &value) const;
+  /*! Lock free lookup - return true and set value if key is in the table */
+    bool lookup(T_sp key, T_sp &value);
+  /*! Return the index of the entry for key or -1, rehashing first if
+      the garbage collector moved an address based key.  Writers only. */
+    gc::Fixnum tableRef_no_lock(T_sp key, gc::Fixnum &hash, bool willAddKey);
+    gc::Fixnum tableRef_no_lock(T_sp key) { gc::Fixnum hash; return this->tableRef_no_lock(key, hash, false); };
 
   /*! Return true if the key is within the hash table */
     bool contains(T_sp key);
 
-  /*! Return the key/value pair in a CONS if found or NIL if not */
+  /*! Return a fresh (key . value) CONS if found or NIL if not.
+      Modifying the CONS does not change the table. */
     List_sp find(T_sp key);
 
     T_mv gethash(T_sp key, T_sp defaultValue = _Nil<T_O>());
@@ -155,9 +256,9 @@ namespace core {
   /*! maps function across a hash table until the function returns false */
     bool /*terminatingMapHash*/ map_while_true(std::function<bool(T_sp, T_sp)> const &fn) const;
 
-  /*! Return the number of entries in the HashTable Vector0 */
+  /*! Return the number of entries (the capacity) of the table */
     int hashTableNumberOfHashes() const;
-  /*! Return the start of the alist in the HashTable Vector0 at hash value */
+  /*! Return an alist holding the (key . value) stored at entry index hash */
     List_sp hashTableAlistAtHash(int hash) const;
 
     string keysAsString();
@@ -53,7 +53,7 @@ public:
 
 public: // Functions here
   virtual T_sp hashTableTest() const { return cl::_sym_eq; };
-  virtual List_sp tableRef_no_lock(T_sp key);
+  virtual gc::Fixnum findEntry(SimpleVector_O &table, T_sp key, gc::Fixnum hash, T_sp &value) const;
   bool keyTest(T_sp entryKey, T_sp searchKey) const;
 
   gc::Fixnum sxhashKey(T_sp key, gc::Fixnum bound, bool willAddKey) const;
@@ -40,11 +40,7 @@ extern T_sp read_lisp_object(T_sp, bool eofErrorP, T_sp eofValue, bool recursive
 
  void unread_ch(T_sp sin, Character_sp c);
 
- Character_sp lexeme_character(T_sp lexeme);
- List_sp collect_lexemes(/*Character_sp*/ T_sp tc, T_sp sin);
- void make_str_preserve_case(StrNs_sp sout, List_sp cur_char);
- void make_str_upcase(StrNs_sp sout, List_sp cur_char);
- void make_str(StrNs_sp sout, List_sp cur_char);
+ void collect_token_string(Character_sp ch, T_sp sin, StrNs_sp sout, bool preserve_case);
  
  
 extern void exposeCore_lisp_reader();
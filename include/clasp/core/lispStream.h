@@ -58,6 +58,10 @@ THE SOFTWARE.
 #define OPEN_A "ab"
 #define OPEN_RA "a+b"
 
+/*! Default size in bytes of the user-space buffer of fd-backed file streams.
+    A buffer size of 0 makes the stream read(2)/write(2) on every operation. */
+#define CLASP_STREAM_DEFAULT_BUFFER_SIZE 8192
+
 namespace core {
 
   enum StreamMode {                          /*  stream mode  */
@@ -166,7 +170,7 @@ T_sp clasp_make_stream_from_FILE(T_sp fname, FILE *f, enum StreamMode smm, gctoo
 
 T_sp clasp_make_stream_from_fd(T_sp fname, int fd, enum StreamMode smm, gctools::Fixnum byte_size = 8, int flags = CLASP_STREAM_DEFAULT_FORMAT, T_sp external_format = _Nil<T_O>());
 
-T_sp clasp_make_file_stream_from_fd(T_sp fname, int fd, enum StreamMode smm, gctools::Fixnum byte_size = 8, int flags = CLASP_STREAM_DEFAULT_FORMAT, T_sp external_format = _Nil<T_O>());
+T_sp clasp_make_file_stream_from_fd(T_sp fname, int fd, enum StreamMode smm, gctools::Fixnum byte_size = 8, int flags = CLASP_STREAM_DEFAULT_FORMAT, T_sp external_format = _Nil<T_O>(), cl_index buffer_size = CLASP_STREAM_DEFAULT_BUFFER_SIZE);
 
 T_sp cl__make_synonym_stream(T_sp sym);
 T_sp cl__make_two_way_stream(T_sp in, T_sp out);
@@ -223,6 +227,10 @@ struct FileOps {
   T_sp (*close)(T_sp strm);
 };
 
+/*! Return the FileOps of an ANSI stream, or the ops that call the
+    Gray stream generic functions for CLOS streams */
+const FileOps &stream_dispatch_table(T_sp strm);
+
 // Define types of streams
 // See ecl object.h:600
 
@@ -351,12 +359,22 @@ class IOFileStream_O : public FileStream_O {
   LISP_CLASS(core, CorePkg, IOFileStream_O, "iofile-stream",FileStream_O);
   //    DECLARE_ARCHIVE();
 public: // Simple default ctor/dtor
-  IOFileStream_O(){};
+  IOFileStream_O() : _BufferSize(0), _InputBuffer(NULL), _InputStart(0), _InputEnd(0), _OutputBuffer(NULL), _OutputFill(0){};
   ~IOFileStream_O();
 
 private: // instance variables here
   int _FileDescriptor;
 
+public: // user-space buffers - the memory is owned by Stream_O::_Buffer
+  cl_index _BufferSize;
+  /*! Bytes read from the descriptor but not yet consumed are [_InputStart,_InputEnd) */
+  unsigned char *_InputBuffer;
+  cl_index _InputStart;
+  cl_index _InputEnd;
+  /*! Bytes written by lisp but not yet handed to write(2) are [0,_OutputFill) */
+  unsigned char *_OutputBuffer;
+  cl_index _OutputFill;
+
 public: // Functions here
   static T_sp makeInput(const string &name, int fd) {
     return clasp_make_stream_from_fd(str_create(name), fd, clasp_smm_input_file, 8, CLASP_STREAM_DEFAULT_FORMAT, _Nil<T_O>());
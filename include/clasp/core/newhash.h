@@ -28,6 +28,8 @@ THE SOFTWARE.
 
 #ifndef newhash_H
 #define newhash_H
+#include <cstdint>
+#include <cstring>
 /********************
  * HASHING ROUTINES *
  ********************/
@@ -302,4 +304,75 @@ static cl_intptr_t hash_full_string(const claspCharacter *s, int len, int h) {
 }
 #endif
 #endif // #if 0
+
+/*
+ * String hashing for SXHASH and EQUAL/EQUALP tables.
+ * Characters are consumed a 64 bit word (eight characters) at a time
+ * and each word is folded into the state with a 64x64->128 bit multiply.
+ * Strings of 32 characters or more are split over four independent
+ * states so that the multiplies overlap in the pipeline.
+ * A base string and a character string with the same characters must
+ * hash the same (they are EQUAL) - so character strings pack the low
+ * eight bits of each character into the word just like base strings
+ * and only fold in the high bits when some character needs them.
+ */
+#define STRING_HASH_K0 0xa0761d6478bd642fULL
+#define STRING_HASH_K1 0xe7037ed1a0b428dbULL
+#define STRING_HASH_K2 0x8ebc6af09c88c6e3ULL
+#define STRING_HASH_K3 0x589965cc75374cc3ULL
+
+inline uint64_t string_hash_mix(uint64_t a, uint64_t b) {
+  __uint128_t r = (__uint128_t)a * b;
+  return (uint64_t)r ^ (uint64_t)(r >> 64);
+}
+
+/*! Load up to eight characters as one little endian word, return in high
+    the bits of the characters that don't fit into eight bits */
+inline uint64_t string_hash_load(const unsigned char *s, size_t n, uint64_t &high) {
+  uint64_t w = 0;
+  memcpy(&w, s, n);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  w = __builtin_bswap64(w);
+#endif
+  high = 0;
+  return w;
+}
+
+inline uint64_t string_hash_load(const int *s, size_t n, uint64_t &high) {
+  uint64_t w = 0;
+  high = 0;
+  for (size_t i = 0; i < n; ++i) {
+    w |= (uint64_t)(s[i] & 0xff) << (8 * i);
+    high = (high << 13) ^ (uint64_t)(s[i] >> 8);
+  }
+  return w;
+}
+
+template <typename CharType>
+inline uint64_t string_hash_step(uint64_t h, const CharType *s, size_t n) {
+  uint64_t high;
+  uint64_t w = string_hash_load(s, n, high);
+  return string_hash_mix(w ^ STRING_HASH_K1, h ^ STRING_HASH_K2 ^ (high * STRING_HASH_K3));
+}
+
+template <typename CharType>
+inline uint64_t hash_string_chars(const CharType *s, size_t len) {
+  const CharType *end = s + len;
+  uint64_t h0 = STRING_HASH_K0 ^ string_hash_mix(len ^ STRING_HASH_K0, STRING_HASH_K1);
+  if (len >= 32) {
+    uint64_t h1 = h0 ^ STRING_HASH_K1, h2 = h0 ^ STRING_HASH_K2, h3 = h0 ^ STRING_HASH_K3;
+    do {
+      h0 = string_hash_step(h0, s, 8);
+      h1 = string_hash_step(h1, s + 8, 8);
+      h2 = string_hash_step(h2, s + 16, 8);
+      h3 = string_hash_step(h3, s + 24, 8);
+      s += 32;
+    } while (end - s >= 32);
+    h0 ^= string_hash_mix(h1 ^ STRING_HASH_K2, h2 ^ h3 ^ STRING_HASH_K3);
+  }
+  for (; end - s >= 8; s += 8) h0 = string_hash_step(h0, s, 8);
+  if (s < end) h0 = string_hash_step(h0, s, end - s);
+  return string_hash_mix(h0 ^ STRING_HASH_K3, len ^ STRING_HASH_K0);
+}
+
 #endif
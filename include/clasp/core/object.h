@@ -133,6 +133,12 @@ namespace core {
     virtual bool mapKeyValue(T_sp key, T_sp value) = 0;
   };
 
+  /*! Map a hash onto [0,bound) with a multiply and a shift rather than a
+      division - this uses the high bits of the hash which are well mixed. */
+  inline gc::Fixnum hash_reduce(gc::Fixnum hash, gc::Fixnum bound) {
+    return (gc::Fixnum)(((__uint128_t)(uint64_t)hash * (uint64_t)bound) >> 64);
+  }
+
   /* A lighter weight hash generator for EQ and EQL tests. 
      It has only a single part. */
 class Hash1Generator {
@@ -142,7 +148,7 @@ class Hash1Generator {
   gc::Fixnum hash(gc::Fixnum bound = 0) const {
     gc::Fixnum hash = 5381;
     hash = (gc::Fixnum)hash_word((cl_intptr_t)5381,(cl_intptr_t)this->_Part);
-    if (bound) return ((cl_intptr_t)hash) % bound;
+    if (bound) return hash_reduce(hash,bound);
 #ifdef DEBUG_HASH_GENERATOR
     if (this->_debug) {
       printf("%s:%d  final hash = %lu\n", __FILE__, __LINE__, hash);
@@ -158,7 +164,7 @@ class Hash1Generator {
       printf("%s:%d  final hash = %lu\n", __FILE__, __LINE__, hash);
     }
 #endif
-    return ((cl_intptr_t)hash) % bound;
+    return hash_reduce(hash,bound);
   }
   bool addPart(Fixnum part) {
     this->_Part = part;
@@ -237,7 +243,7 @@ class Hash1Generator {
 #endif
       }
       if (bound)
-        return ((cl_intptr_t)hash) % bound;
+        return hash_reduce(hash,bound);
 #ifdef DEBUG_HASH_GENERATOR
       if (this->_debug) {
         printf("%s:%d  final hash = %lu\n", __FILE__, __LINE__, hash);
@@ -31,7 +31,9 @@ THE SOFTWARE.
 #include <string>
 #include <vector>
 #include <set>
+#include <functional>
 #include <clasp/core/object.h>
+#include <clasp/core/array.fwd.h>
 #include <clasp/core/hashTable.fwd.h>
 #include <clasp/core/bignum.fwd.h>
 #include <clasp/core/mpPackage.h>
@@ -42,6 +44,44 @@ namespace core {
 #define WITH_PACKAGE_READ_LOCK(pkg) WITH_READ_LOCK(pkg->_Lock)
 #define WITH_PACKAGE_READ_WRITE_LOCK(pkg) WITH_READ_WRITE_LOCK(pkg->_Lock)
 
+FORWARD(SimpleVector_byte64_t);
+
+/*! A symbol name to look up - the characters of any string and their hash.
+    The hash is computed once and reused for every table that is searched. */
+struct SymbolNameKey {
+  AbstractSimpleVector_sp _Chars;
+  size_t _Start;
+  size_t _End;
+  uint64_t _Hash;
+  explicit SymbolNameKey(String_sp name);
+  size_t length() const { return this->_End - this->_Start; };
+  bool matches(SimpleString_sp name) const;
+};
+
+/*! Open addressing table from symbol names to symbols used by packages.
+    Every slot stores the hash of its name so probing only compares the
+    characters of names whose hashes are equal. */
+struct SymbolNameTable {
+  SimpleVector_sp _Entries;         // name,symbol pairs
+  SimpleVector_byte64_t_sp _Hashes; // see SYMBOL_NAME_HASH_EMPTY/DELETED
+  size_t _Count;                    // live entries
+  size_t _Used;                     // live + deleted entries
+  void initialize();
+  size_t count() const { return this->_Count; };
+  bool find(const SymbolNameKey &key, Symbol_sp &sym) const;
+  /*! Add sym under name, replacing any symbol with that name */
+  void insert(const SymbolNameKey &key, SimpleString_sp name, Symbol_sp sym);
+  bool remove(const SymbolNameKey &key);
+  void clear();
+  /*! Stops when the mapper returns false */
+  void map(KeyValueMapper *mapper) const;
+  void mapSymbols(std::function<void(Symbol_sp)> const &fn) const;
+  /*! Return a fresh EQUAL hash table of the name/symbol pairs */
+  HashTableEqual_sp asHashTable() const;
+private:
+  void rehash(size_t capacity);
+};
+
 
 SMART(Package);
 class Package_O : public General_O {
@@ -51,8 +91,8 @@ class Package_O : public General_O {
   void initialize();
   string __repr__() const;
  public: // instance variables
-  HashTableEqual_sp _InternalSymbols;
-  HashTableEqual_sp _ExternalSymbols;
+  SymbolNameTable _InternalSymbols;
+  SymbolNameTable _ExternalSymbols;
   HashTableEq_sp _Shadowing;
   SimpleString_sp _Name;
   gctools::Vec0<Package_sp> _UsingPackages;
@@ -86,8 +126,6 @@ class Package_O : public General_O {
  public:
   string packageName() const;
 
-  T_mv packageHashTables() const;
-
   void setNicknames(List_sp nicknames) {
     WITH_PACKAGE_READ_WRITE_LOCK(this);
     this->_Nicknames = nicknames;
@@ -132,6 +170,8 @@ class Package_O : public General_O {
   /*! Return the symbol if we contain it directly */
   Symbol_mv findSymbolDirectlyContained(String_sp nameKey) const;
 
+  Symbol_mv findSymbol_no_lock(const SymbolNameKey &key) const;
+  Symbol_mv findSymbol_no_lock(String_sp nameKey) const;
   Symbol_mv findSymbol_SimpleString_no_lock(SimpleString_sp nameKey) const;
   Symbol_mv findSymbol_SimpleString(SimpleString_sp nameKey) const;
 
@@ -186,7 +226,8 @@ class Package_O : public General_O {
   /*! Dump all the symbols to stdout */
   void dumpSymbols();
 
-  /*! Return the External(HashTable), Internal(HashTable) and UseList(list) */
+  /*! Return the External(HashTable), Internal(HashTable) and UseList(list)
+      The hash tables are copies of the package's symbol tables */
   T_mv hashTables() const;
 
   /*! Map over the External key/value pairs */
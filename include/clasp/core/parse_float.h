@@ -0,0 +1,132 @@
+/*
+    File: parse_float.h
+*/
+
+/*
+Copyright (c) 2014, Christian E. Schafmeister
+ 
+CLASP is free software; you can redistribute it and/or
+modify it under the terms of the GNU Library General Public
+License as published by the Free Software Foundation; either
+version 2 of the License, or (at your option) any later version.
+ 
+See directory 'clasp/licenses' for full details.
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/* -^- */
+#ifndef _core__parse_float_H //[
+#define _core__parse_float_H
+
+#include <stdint.h>
+
+namespace core {
+
+/*! A decimal float as scanned from text, its value is
+    _Mantissa * 10^_Exponent.  Only the first 19 significant digits go into
+    the mantissa, _Truncated is set if there were more. */
+struct DecimalFloat {
+  bool _Negative;
+  bool _Truncated;
+  uint64_t _Mantissa;
+  int64_t _Exponent;
+  claspCharacter _ExponentMarker; // 0 if there is no exponent
+};
+
+#define DECIMAL_FLOAT_MAX_DIGITS 19
+#define DECIMAL_FLOAT_EXPONENT_LIMIT 100000
+
+/*! Scan [sign] digits [. digits] [marker [sign] digits] with at least one
+    mantissa digit.  charAt(i) returns the character at index i.
+    Return the number of characters that make up the float or 0 if there is
+    no float syntax at the start. */
+template <typename CharAt>
+size_t scan_decimal_float(size_t length, CharAt charAt, DecimalFloat &dec) {
+  size_t cur = 0;
+  dec._Negative = false;
+  dec._Truncated = false;
+  dec._Mantissa = 0;
+  dec._Exponent = 0;
+  dec._ExponentMarker = 0;
+  if (cur < length && (charAt(cur) == '+' || charAt(cur) == '-')) {
+    dec._Negative = (charAt(cur) == '-');
+    ++cur;
+  }
+  size_t digits = 0;
+  size_t significant = 0;
+  bool seenPoint = false;
+  for (; cur < length; ++cur) {
+    claspCharacter c = charAt(cur);
+    if (c == '.' && !seenPoint) {
+      seenPoint = true;
+      continue;
+    }
+    if (c < '0' || c > '9') break;
+    ++digits;
+    // Leading zeros are not significant
+    if (significant == 0 && c == '0') {
+      if (seenPoint) --dec._Exponent;
+      continue;
+    }
+    if (significant < DECIMAL_FLOAT_MAX_DIGITS) {
+      dec._Mantissa = dec._Mantissa * 10 + (c - '0');
+      if (seenPoint) --dec._Exponent;
+    } else {
+      if (c != '0') dec._Truncated = true;
+      if (!seenPoint) ++dec._Exponent;
+    }
+    ++significant;
+  }
+  if (digits == 0) return 0;
+  if (cur < length) {
+    claspCharacter marker = charAt(cur);
+    switch (marker) {
+    case 'e': case 'E': case 's': case 'S': case 'f': case 'F':
+    case 'd': case 'D': case 'l': case 'L': {
+      size_t expCur = cur + 1;
+      bool expNegative = false;
+      if (expCur < length && (charAt(expCur) == '+' || charAt(expCur) == '-')) {
+        expNegative = (charAt(expCur) == '-');
+        ++expCur;
+      }
+      int64_t exp = 0;
+      size_t expDigits = 0;
+      for (; expCur < length; ++expCur) {
+        claspCharacter c = charAt(expCur);
+        if (c < '0' || c > '9') break;
+        // Anything this large overflows or underflows anyway
+        if (exp < DECIMAL_FLOAT_EXPONENT_LIMIT) exp = exp * 10 + (c - '0');
+        ++expDigits;
+      }
+      // Without exponent digits the marker is not part of the float
+      if (expDigits) {
+        dec._ExponentMarker = marker;
+        dec._Exponent += expNegative ? -exp : exp;
+        cur = expCur;
+      }
+    } break;
+    default:
+      break;
+    }
+  }
+  return cur;
+}
+
+/*! Convert exactly with machine arithmetic (Clinger's fast path, then
+    Eisel-Lemire).  Return false in the rare cases where that can't be
+    done, the caller must then convert the text with strtod/strtof. */
+bool decimal_float_to_double(const DecimalFloat &dec, double &result);
+bool decimal_float_to_float(const DecimalFloat &dec, float &result);
+
+};
+
+#endif //]
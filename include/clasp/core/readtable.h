@@ -39,6 +39,22 @@ enum clasp_readtable_case {
   clasp_case_preserve
 };
 
+/*! Syntax types as small integers so that the reader can switch on them.
+    ReadTable_O::syntax_type still returns the keywords. */
+typedef enum {
+  syntax_constituent = 0,
+  syntax_whitespace,
+  syntax_terminating_macro,
+  syntax_non_terminating_macro,
+  syntax_single_escape,
+  syntax_multiple_escape,
+  syntax_invalid
+} ReadTableSyntax;
+
+/*! Characters below this code have their syntax and macro function
+    mirrored in flat tables in every readtable. */
+#define READTABLE_DENSE_CHARS 256
+
 FORWARD(ReadTable);
 class ReadTable_O : public General_O {
   LISP_CLASS(core, ClPkg, ReadTable_O, "readtable",General_O);
@@ -58,6 +74,10 @@ GCPRIVATE: // instance variables here
   HashTable_sp _SyntaxTypes;
   HashTable_sp _MacroCharacters;
   HashTable_sp _DispatchMacroCharacters;
+  /*! The hash tables above are the record for every character; these mirror
+      them for the base chars so the reader never hashes a character. */
+  SimpleVector_sp _DenseMacroFunctions;
+  unsigned char _DenseSyntax[READTABLE_DENSE_CHARS];
 
 public: // static functions here
   static ReadTable_sp create_standard_readtable();
@@ -81,6 +101,19 @@ public: // instance member functions here
   /*! syntax-type returns the syntax type of a character */
   Symbol_sp syntax_type(Character_sp ch) const;
 
+  static ReadTableSyntax syntax_code_from_symbol(T_sp syntaxType);
+  static Symbol_sp syntax_symbol_from_code(ReadTableSyntax code);
+  ReadTableSyntax syntax_code_from_table(claspCharacter c) const;
+  /*! The syntax type of a character as a ReadTableSyntax */
+  inline ReadTableSyntax syntax_code(claspCharacter c) const {
+    if ((unsigned)c < READTABLE_DENSE_CHARS) return (ReadTableSyntax)this->_DenseSyntax[c];
+    return this->syntax_code_from_table(c);
+  }
+  /*! The function designator of a macro character or NIL */
+  T_sp macro_function(claspCharacter c) const;
+  /*! Rebuild the dense tables from the hash tables */
+  void refresh_dense_tables();
+
   /*! Define a macro character */
   T_sp set_macro_character(Character_sp ch, T_sp funcDesig, T_sp non_terminating);
 
@@ -0,0 +1,53 @@
+/*
+    File: sampleProfiler.h
+*/
+
+/*
+Copyright (c) 2018, Christian E. Schafmeister
+
+CLASP is free software; you can redistribute it and/or
+modify it under the terms of the GNU Library General Public
+License as published by the Free Software Foundation; either
+version 2 of the License, or (at your option) any later version.
+
+See directory 'clasp/licenses' for full details.
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/* -^- */
+
+#if !defined( CLASP_CORE_SAMPLE_PROFILER_H )
+#define CLASP_CORE_SAMPLE_PROFILER_H
+
+#include <clasp/core/foundation.h>
+#include <clasp/core/corePackage.h>
+
+namespace core {
+
+/*! A statistical CPU profiler.
+    A CPU time timer delivers SIGPROF to whichever thread is running; the handler
+    walks the frame pointer chain and pushes the raw return addresses into a
+    ring buffer owned by that thread.  A collector thread drains the buffers
+    into a table of unique stacks and symbols are only looked up (JIT symbol
+    index, then dladdr) when the profile is written out as folded stacks. */
+void sample_profiler_start(size_t frequency);
+size_t sample_profiler_stop();
+bool sample_profiler_running();
+
+/*! Sample allocations - on average once every bytes_per_sample bytes
+    allocated by any thread - recording the stamp and the allocating stack */
+void allocation_sampler_start(size_t bytes_per_sample);
+size_t allocation_sampler_stop();
+
+}
+
+#endif
@@ -61,6 +61,7 @@ public:
   Function_sp _Function;
   Function_sp _SetfFunction;
   mutable size_t _Binding;
+  mutable uint64_t _NameHash; // 0 until nameHash() is first called
   bool _IsSpecial;
   bool _IsConstant;
   bool _IsMacro;
@@ -120,7 +121,9 @@ public:
 #endif
   };
 
-  void setf_name(SimpleString_sp nm) { this->_Name = nm; };
+  void setf_name(SimpleString_sp nm) { this->_Name = nm; this->_NameHash = 0; };
+  /*! Symbol names are never modified so the hash of the name is cached */
+  uint64_t nameHash() const;
 
   List_sp plist() const { return this->_PropertyList; };
   void setf_plist(List_sp plist);
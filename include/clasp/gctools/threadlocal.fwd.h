@@ -26,31 +26,86 @@ namespace gctools {
 #endif
    
 
+ /*! Bytes and number of objects allocated with one stamp */
+ struct AllocationRecord {
+   std::atomic<int64_t> _Bytes;
+   std::atomic<int64_t> _Count;
+ };
+
+ /*! Return the number of entries in an allocation histogram - one per
+     stamp up to STAMP_max and one more that collects all larger stamps */
+ size_t allocation_histogram_size();
+
+ struct GlobalAllocationProfiler;
+ /*! Called when a thread's sampling countdown runs out - see ext:start-allocation-profiling */
+ void sample_allocation(GlobalAllocationProfiler& profiler, stamp_t stamp, size_t size);
+ /*! How often (in bytes) a thread checks whether allocation sampling was turned on */
+ const int64_t AllocationSampleCheckInterval = 1024*1024;
+
+ /*! Per-thread allocation accounting.
+     Only the owning thread ever writes these counters, so they are bumped
+     with a relaxed load and store rather than a locked read-modify-write -
+     the code is the same as for a plain integer but other threads may read
+     them to merge statistics (see gctools:allocation-statistics). */
  struct GlobalAllocationProfiler {
    std::atomic<int64_t> _BytesAllocated;
-   std::atomic<int64_t> _AllocationNumberCounter;
-   std::atomic<int64_t> _AllocationSizeCounter;
-   std::atomic<int64_t> _HitAllocationNumberCounter;
-   std::atomic<int64_t> _HitAllocationSizeCounter;
+   int64_t              _AllocationNumberCounter;
+   int64_t              _AllocationSizeCounter;
+   int64_t              _HitAllocationNumberCounter;
+   int64_t              _HitAllocationSizeCounter;
    size_t               _AllocationNumberThreshold;
    size_t               _AllocationSizeThreshold;
+   size_t               _HistogramSize;
+   AllocationRecord*    _Histogram;
+   // Bytes left until sample_allocation is called; the next countdown is
+   // drawn from an exponential distribution while allocation sampling is on
+   int64_t              _SampleCountdown;
+   uint64_t             _SampleRandom;
+   size_t               _SampleSession;
 #ifdef DEBUG_MONITOR_ALLOCATIONS
    MonitorAllocations _Monitor;
 #endif
    
  GlobalAllocationProfiler() :
-   _AllocationSizeThreshold(1024*1024)
+   _BytesAllocated(0)
+   , _AllocationNumberCounter(0)
+   , _AllocationSizeCounter(0)
+   , _HitAllocationNumberCounter(0)
+   , _HitAllocationSizeCounter(0)
    , _AllocationNumberThreshold(1024)
-     , _HitAllocationNumberCounter(0)
-     , _HitAllocationSizeCounter(0)
+   , _AllocationSizeThreshold(1024*1024)
+   , _HistogramSize(allocation_histogram_size())
+   , _Histogram(new AllocationRecord[allocation_histogram_size()]())
+   , _SampleCountdown(AllocationSampleCheckInterval)
+   , _SampleRandom((uint64_t)(uintptr_t)this | 1)
+   , _SampleSession(0)
    {};
- GlobalAllocationProfiler(size_t size, size_t number) : _AllocationSizeThreshold(size), _AllocationNumberThreshold(number)
-     , _HitAllocationNumberCounter(0)
-     , _HitAllocationSizeCounter(0)
+ GlobalAllocationProfiler(size_t size, size_t number) :
+   _BytesAllocated(0)
+   , _AllocationNumberCounter(0)
+   , _AllocationSizeCounter(0)
+   , _HitAllocationNumberCounter(0)
+   , _HitAllocationSizeCounter(0)
+   , _AllocationNumberThreshold(number)
+   , _AllocationSizeThreshold(size)
+   , _HistogramSize(allocation_histogram_size())
+   , _Histogram(new AllocationRecord[allocation_histogram_size()]())
+   , _SampleCountdown(AllocationSampleCheckInterval)
+   , _SampleRandom((uint64_t)(uintptr_t)this | 1)
+   , _SampleSession(0)
    {};
+   ~GlobalAllocationProfiler() { delete[] this->_Histogram; };
+
+   static inline void bump(std::atomic<int64_t>& counter, int64_t delta) {
+     counter.store(counter.load(std::memory_order_relaxed)+delta,std::memory_order_relaxed);
+   }
     
    inline void registerAllocation(stamp_t stamp, size_t size) {
-     this->_BytesAllocated += size;
+     bump(this->_BytesAllocated,size);
+     AllocationRecord& record = this->_Histogram[(stamp<this->_HistogramSize) ? stamp : this->_HistogramSize-1];
+     bump(record._Bytes,size);
+     bump(record._Count,1);
+     if ((this->_SampleCountdown -= (int64_t)size) < 0) sample_allocation(*this,stamp,size);
      this->_AllocationSizeCounter += size;
      this->_AllocationNumberCounter++;
 #if defined(DEBUG_COUNT_ALLOCATIONS) && defined(DEBUG_SLOW)
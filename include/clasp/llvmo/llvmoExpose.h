@@ -4180,7 +4180,7 @@ namespace llvmo {
   using namespace llvm;
   using namespace llvm::orc;
 
-  void save_symbol_info(const llvm::object::ObjectFile& object_file, const llvm::RuntimeDyld::LoadedObjectInfo& loaded_object_info);
+  void save_symbol_info(const llvm::object::ObjectFile& object_file, const llvm::RuntimeDyld::LoadedObjectInfo& loaded_object_info, void* owner);
 };
 
 // Don't allow the object to move, but maybe I'll need to collect it
@@ -4259,6 +4259,7 @@ namespace llvmo {
   };
 
   core::T_sp llvm_sys__lookup_jit_symbol_info(void* ptr);
+  core::T_sp llvm_sys__jit_symbol_info(core::String_sp name);
 
   std::shared_ptr<llvm::Module> optimizeModule(std::shared_ptr<llvm::Module> M);
 };
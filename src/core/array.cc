@@ -154,10 +154,7 @@ bool ranged_bit_vector_EQ_(const SimpleBitVector_O& bvx,const SimpleBitVector_O&
   size_t lenx = endx - startx;
   size_t leny = endy - starty;
   if (lenx!=leny) return false;
-  for (size_t ix(startx), iy(starty); ix<endx; ++ix, ++iy ) {
-    if (bvx.testBit(ix) != bvy.testBit(iy)) return false;
-  }
-  return true;
+  return bit_array_equal(&bvx._Data[0],startx,&bvy._Data[0],starty,lenx);
 }
 
 Array_sp ranged_bit_vector_reverse(SimpleBitVector_sp sv, size_t start, size_t end) {
@@ -2082,9 +2079,7 @@ void SimpleBitVector_O::unsafe_fillArrayWithElt(T_sp initialElement, size_t star
   {
     Fixnum zero_or_one = gc::As<core::Fixnum_sp>(initialElement).unsafe_fixnum();
     if ((zero_or_one == 0) || (zero_or_one == 1)) {
-      for (size_t i(start),iEnd(end); i<iEnd; ++i) {
-        this->setBit(i, zero_or_one);
-      }
+      bit_array_fill(this->bytes(), start, end, zero_or_one);
     }
     else TYPE_ERROR(initialElement, cl::_sym_bit);
   }
@@ -2152,20 +2147,11 @@ void SimpleBitVector_getOnIndices(SimpleBitVector_sp x, vector<size_t> &res) {
 }
 
 size_t SimpleBitVector_lowestIndex(SimpleBitVector_sp x) {
-  size_t i;
-  for (i = 0; i < x->length(); i++) {
-    if (x->testBit(i)) {
-      return i;
-    }
-  }
-  return i;
+  gc::Fixnum i = bit_array_position(x->bytes(), 0, x->length(), 1, false);
+  return (i < 0) ? x->length() : i;
 }
 bool SimpleBitVector_isZero(SimpleBitVector_sp x) {
-  size_t i;
-  for (i = 0; i < x->length(); i++) {
-    if (x->testBit(i)) return false;
-  }
-  return true;
+  return bit_array_position(x->bytes(), 0, x->length(), 1, false) < 0;
 }
 // ------------------------------------------------------------
 //
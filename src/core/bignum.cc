@@ -373,7 +373,7 @@ Integer_mv big_floor(Bignum_sp a, Bignum_sp b) {
   Bignum_sp r = my_thread->bigRegister1();
   mpz_fdiv_qr(q->ref().get_mpz_t(), r->ref().get_mpz_t(),
               a->ref().get_mpz_t(), b->ref().get_mpz_t());
-  return Values(Integer_O::create(q->get()), Integer_O::create(r->get()));
+  return Values(Integer_O::create(q->ref()), Integer_O::create(r->ref()));
 }
 
 Integer_sp _clasp_big_gcd(Bignum_sp x, Bignum_sp y) {
@@ -403,10 +403,86 @@ Integer_sp _clasp_fix_divided_by_big(const Fixnum &x, const Bignum &y) {
   return _clasp_big_divided_by_big(bx, y);
 }
 
+// Registers that grew past this are shrunk again so that one huge
+// computation doesn't pin its memory in every thread that did one
+#define BIGNUM_REGISTER_MAX_LIMBS 1024
+#define BIGNUM_REGISTER_LIMBS 16
+
 void clasp_big_register_free(Bignum_sp b) {
-  // ECL just returns but we
-  // could clear out the bignum register if it's too big
-  return;
+  mpz_ptr z = b->ref().get_mpz_t();
+  if (z->_mp_alloc > BIGNUM_REGISTER_MAX_LIMBS) {
+    mpz_realloc2(z, BIGNUM_REGISTER_LIMBS * GMP_NUMB_BITS);
+  }
+}
+
+/*! The value of a register, which is then ready for the next operation */
+static Integer_sp big_register_result(Bignum_sp reg) {
+  Integer_sp result = _clasp_big_register_normalize(reg);
+  clasp_big_register_free(reg);
+  return result;
+}
+
+/*! z = x + y for a fixnum y, GMP only takes unsigned longs */
+static inline void big_add_fix(mpz_ptr z, mpz_srcptr x, Fixnum y) {
+  if (y >= 0) mpz_add_ui(z, x, (unsigned long)y);
+  else mpz_sub_ui(z, x, -(unsigned long)y);
+}
+
+Integer_sp _clasp_fix_plus_fix(Fixnum x, Fixnum y) {
+  // Fixnums have fewer bits than a Fixnum so this never overflows
+  return Integer_O::create(x + y);
+}
+
+Integer_sp _clasp_fix_minus_fix(Fixnum x, Fixnum y) {
+  return Integer_O::create(x - y);
+}
+
+Integer_sp _clasp_fix_times_fix(Fixnum x, Fixnum y) {
+  Fixnum z;
+  if (!__builtin_mul_overflow(x, y, &z)) return Integer_O::create(z);
+  Bignum_sp reg = my_thread->bigRegister0();
+  mpz_ptr zr = reg->ref().get_mpz_t();
+  mpz_set_si(zr, GMP_LONG(x));
+  mpz_mul_si(zr, zr, GMP_LONG(y));
+  return big_register_result(reg);
+}
+
+Integer_sp _clasp_big_plus_fix(const Bignum &x, Fixnum y) {
+  Bignum_sp reg = my_thread->bigRegister0();
+  big_add_fix(reg->ref().get_mpz_t(), x.get_mpz_t(), y);
+  return big_register_result(reg);
+}
+
+Integer_sp _clasp_fix_minus_big(Fixnum x, const Bignum &y) {
+  Bignum_sp reg = my_thread->bigRegister0();
+  mpz_ptr zr = reg->ref().get_mpz_t();
+  mpz_neg(zr, y.get_mpz_t());
+  big_add_fix(zr, zr, x);
+  return big_register_result(reg);
+}
+
+Integer_sp _clasp_big_times_fix(const Bignum &x, Fixnum y) {
+  Bignum_sp reg = my_thread->bigRegister0();
+  mpz_mul_si(reg->ref().get_mpz_t(), x.get_mpz_t(), GMP_LONG(y));
+  return big_register_result(reg);
+}
+
+Integer_sp _clasp_big_plus_big(const Bignum &x, const Bignum &y) {
+  Bignum_sp reg = my_thread->bigRegister0();
+  mpz_add(reg->ref().get_mpz_t(), x.get_mpz_t(), y.get_mpz_t());
+  return big_register_result(reg);
+}
+
+Integer_sp _clasp_big_minus_big(const Bignum &x, const Bignum &y) {
+  Bignum_sp reg = my_thread->bigRegister0();
+  mpz_sub(reg->ref().get_mpz_t(), x.get_mpz_t(), y.get_mpz_t());
+  return big_register_result(reg);
+}
+
+Integer_sp _clasp_big_times_big(const Bignum &x, const Bignum &y) {
+  Bignum_sp reg = my_thread->bigRegister0();
+  mpz_mul(reg->ref().get_mpz_t(), x.get_mpz_t(), y.get_mpz_t());
+  return big_register_result(reg);
 }
 
 Bignum CStrToBignum(const char *str) {
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cstring>
 #include <clasp/core/foundation.h>
 #include <clasp/core/corePackage.h>
 #include <clasp/core/symbolTable.h>
@@ -306,6 +308,176 @@ T_sp clasp_boole(int op, T_sp x, T_sp y) {
 }
 
 
+// ----------------------------------------------------------------------
+//
+// Word at a time bit vector scans
+//
+// Bit i of a bit vector is stored in word i/bit_word_bits, counting from
+// the most significant bit of the word.  load_bits funnels the bits that
+// start at any bit position into a left justified 64 bit word so ranges that
+// don't start on a word boundary are handled 64 bits at a time too.
+
+typedef SimpleBitVector_O::value_type bit_word;
+static const size_t bit_word_bits = sizeof(bit_word) * CHAR_BIT;
+static const bit_word bit_word_ones = (bit_word)~(bit_word)0;
+
+/*! Return the n (1..64) bits starting at bit pos left justified, the low
+    64-n bits are garbage.  Only the words holding those bits are read. */
+static inline ALWAYS_INLINE uint64_t load_bits(const bit_word* p, size_t pos, size_t n) {
+  size_t w = pos / bit_word_bits;
+  size_t s = pos % bit_word_bits;
+  uint64_t v = (uint64_t)p[w] << (64 - bit_word_bits + s);
+  for (size_t have = bit_word_bits - s; have < n; have += bit_word_bits) {
+    ++w;
+    if (have <= 64 - bit_word_bits)
+      v |= (uint64_t)p[w] << (64 - bit_word_bits - have);
+    else
+      v |= (uint64_t)p[w] >> (have - (64 - bit_word_bits));
+  }
+  return v;
+}
+
+/*! Store the top n (1..64) bits of v at bit pos, leaving the bits around
+    them alone. */
+static inline ALWAYS_INLINE void store_bits(bit_word* p, size_t pos, size_t n, uint64_t v) {
+  while (n > 0) {
+    size_t w = pos / bit_word_bits;
+    size_t s = pos % bit_word_bits;
+    size_t take = std::min(bit_word_bits - s, n);
+    bit_word mask = (bit_word)(bit_word_ones >> s);
+    if (s + take < bit_word_bits)
+      mask &= (bit_word)~(bit_word)(bit_word_ones >> (s + take));
+    bit_word bits = (bit_word)((v >> (64 - bit_word_bits)) >> s);
+    p[w] = (p[w] & ~mask) | (bits & mask);
+    v <<= take;
+    pos += take;
+    n -= take;
+  }
+}
+
+static inline uint64_t leading_mask(size_t n) {
+  return ~(uint64_t)0 << (64 - n);
+}
+
+static inline ALWAYS_INLINE size_t bit_count_kernel(const bit_word* p, size_t start, size_t end) {
+  size_t count = 0;
+  size_t i = start;
+  size_t head = std::min((bit_word_bits - start % bit_word_bits) % bit_word_bits, end - start);
+  if (head) {
+    count += __builtin_popcountll(load_bits(p, i, head) & leading_mask(head));
+    i += head;
+  }
+  const bit_word* words = p + i / bit_word_bits;
+  size_t nwords = (end - i) / bit_word_bits;
+  for (size_t k = 0; k < nwords; ++k) {
+    count += __builtin_popcount(words[k]);
+  }
+  i += nwords * bit_word_bits;
+  if (i < end) {
+    count += __builtin_popcountll(load_bits(p, i, end - i) & leading_mask(end - i));
+  }
+  return count;
+}
+
+static size_t bit_count_generic(const bit_word* p, size_t start, size_t end) {
+  return bit_count_kernel(p, start, end);
+}
+
+#if defined(__x86_64__)
+// Every processor with AVX2 also has POPCNT
+__attribute__((target("avx2,popcnt")))
+static size_t bit_count_avx2(const bit_word* p, size_t start, size_t end) {
+  return bit_count_kernel(p, start, end);
+}
+#endif
+
+static bool cpu_has_avx2() {
+#if defined(__x86_64__)
+  static bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+#else
+  return false;
+#endif
+}
+
+/*! Number of one bits in [start,end) */
+size_t bit_array_count(const bit_word* p, size_t start, size_t end) {
+#if defined(__x86_64__)
+  if (cpu_has_avx2()) return bit_count_avx2(p, start, end);
+#endif
+  return bit_count_generic(p, start, end);
+}
+
+/*! Index of the first (or last when from_end) bit in [start,end) equal
+    to bit, or -1 if there is none */
+gc::Fixnum bit_array_position(const bit_word* p, size_t start, size_t end, uint bit, bool from_end) {
+  uint64_t flip = bit ? 0 : ~(uint64_t)0;
+  if (!from_end) {
+    for (size_t i = start; i < end; i += 64) {
+      size_t n = std::min((size_t)64, end - i);
+      uint64_t v = (load_bits(p, i, n) ^ flip) & leading_mask(n);
+      if (v) return i + __builtin_clzll(v);
+    }
+  } else {
+    for (size_t i = end; i > start;) {
+      size_t n = std::min((size_t)64, i - start);
+      i -= n;
+      uint64_t v = (load_bits(p, i, n) ^ flip) & leading_mask(n);
+      if (v) return i + 63 - __builtin_ctzll(v);
+    }
+  }
+  return -1;
+}
+
+bool bit_array_equal(const bit_word* x, size_t startx, const bit_word* y, size_t starty, size_t len) {
+  size_t i = 0;
+  if (startx % bit_word_bits == 0 && starty % bit_word_bits == 0) {
+    size_t nwords = len / bit_word_bits;
+    if (memcmp(x + startx / bit_word_bits, y + starty / bit_word_bits, nwords * sizeof(bit_word)) != 0)
+      return false;
+    i = nwords * bit_word_bits;
+  }
+  for (; i < len; i += 64) {
+    size_t n = std::min((size_t)64, len - i);
+    if ((load_bits(x, startx + i, n) ^ load_bits(y, starty + i, n)) & leading_mask(n))
+      return false;
+  }
+  return true;
+}
+
+void bit_array_fill(bit_word* p, size_t start, size_t end, uint bit) {
+  uint64_t value = bit ? ~(uint64_t)0 : 0;
+  size_t i = start;
+  size_t head = std::min((bit_word_bits - start % bit_word_bits) % bit_word_bits, end - start);
+  if (head) {
+    store_bits(p, i, head, value);
+    i += head;
+  }
+  size_t nwords = (end - i) / bit_word_bits;
+  std::fill(p + i / bit_word_bits, p + i / bit_word_bits + nwords, (bit_word)value);
+  i += nwords * bit_word_bits;
+  if (i < end)
+    store_bits(p, i, end - i, value);
+}
+
+CL_LAMBDA(bit-vector bit start end);
+CL_DECLARE();
+CL_DOCSTRING("Count the elements of the simple-bit-vector between start and end that are equal to bit.");
+CL_DEFUN size_t core__bit_vector_count(SimpleBitVector_sp bv, int bit, size_t start, size_t end) {
+  size_t ones = bit_array_count(bv->bytes(), start, end);
+  return bit ? ones : (end - start) - ones;
+}
+
+CL_LAMBDA(bit-vector bit start end from-end);
+CL_DECLARE();
+CL_DOCSTRING("Return the index of the first (last if from-end) element of the simple-bit-vector between start and end that is equal to bit, or NIL.");
+CL_DEFUN T_sp core__bit_vector_position(SimpleBitVector_sp bv, int bit, size_t start, size_t end, bool from_end) {
+  gc::Fixnum pos = bit_array_position(bv->bytes(), start, end, bit, from_end);
+  if (pos < 0) return _Nil<T_O>();
+  return clasp_make_fixnum(pos);
+}
+
+
 #if BIT_ARRAY_BYTE_SIZE==8
 CL_LAMBDA(op x y &optional r);
 CL_DECLARE();
@@ -441,32 +613,95 @@ ERROR:
 
 
 #if BIT_ARRAY_BYTE_SIZE==32
-#define mask32 0xFFFFFFFF00000000
-template <typename Place, typename Nbits, typename Value>
-inline void set_high32(Place& place, Nbits nbits, Value value)
-{
-  (place) = ((place) & ~(mask32 >> (nbits))) | ((value) & (mask32>> (nbits)));
+
+template <int OP, typename W>
+static inline ALWAYS_INLINE W bit_op(W x, W y) {
+  switch (OP) {
+  case b_clr_op_id: return 0;
+  case and_op_id:   return x & y;
+  case andc2_op_id: return x & ~y;
+  case b_1_op_id:   return x;
+  case andc1_op_id: return ~x & y;
+  case b_2_op_id:   return y;
+  case xor_op_id:   return x ^ y;
+  case ior_op_id:   return x | y;
+  case nor_op_id:   return ~(x | y);
+  case eqv_op_id:   return ~(x ^ y);
+  case b_c2_op_id:  return ~y;
+  case orc2_op_id:  return x | ~y;
+  case b_c1_op_id:  return ~x;
+  case orc1_op_id:  return ~x | y;
+  case nand_op_id:  return ~(x & y);
+  default:          return ~(W)0;
+  }
 }
 
-template <typename Place, typename Nbits, typename Value>
-inline void set_low32(Place& place, Nbits nbits, Value value) {
-  (place) = ((place) & (mask32 >> (32 - (nbits)))) | ((value) & ~(mask32 >> (32 - (nbits))));
+/*! r[ro..ro+d) = OP(x[xo..xo+d), y[yo..yo+d)).  When all three ranges
+    start on a word boundary the op doesn't care about the bit order and
+    the word loop below is left to the vectorizer.  Otherwise the result
+    is brought to a word boundary and the sources are funneled in 64 bits
+    at a time. */
+template <int OP>
+static inline ALWAYS_INLINE void bit_array_op_kernel(bit_word* rp, size_t ro, const bit_word* xp, size_t xo, const bit_word* yp, size_t yo, size_t d) {
+  size_t i = 0;
+  if ((xo | yo | ro) % bit_word_bits == 0) {
+    bit_word* r = rp + ro / bit_word_bits;
+    const bit_word* x = xp + xo / bit_word_bits;
+    const bit_word* y = yp + yo / bit_word_bits;
+    size_t nwords = d / bit_word_bits;
+    for (size_t w = 0; w < nwords; ++w) {
+      r[w] = bit_op<OP>(x[w], y[w]);
+    }
+    i = nwords * bit_word_bits;
+  } else {
+    size_t head = std::min((bit_word_bits - ro % bit_word_bits) % bit_word_bits, d);
+    if (head) {
+      store_bits(rp, ro, head, bit_op<OP>(load_bits(xp, xo, head), load_bits(yp, yo, head)));
+      i = head;
+    }
+    bit_word* r = rp + (ro + i) / bit_word_bits;
+    for (; i + 64 <= d; i += 64, r += 2) {
+      uint64_t v = bit_op<OP>(load_bits(xp, xo + i, 64), load_bits(yp, yo + i, 64));
+      r[0] = (bit_word)(v >> 32);
+      r[1] = (bit_word)v;
+    }
+  }
+  if (i < d) {
+    size_t n = d - i;
+    store_bits(rp, ro + i, n, bit_op<OP>(load_bits(xp, xo + i, n), load_bits(yp, yo + i, n)));
+  }
 }
 
-template <typename Integer, typename Pointer, typename Index, typename Offset>
-inline void extract_byte32(Integer& integer, Pointer pointer, Index index, Offset offset) {
-  (integer) = (pointer)[(index)+1] & (~mask32);
-  (integer) = ((pointer)[index] << (offset)) | ((integer) >> (32 - (offset)));
+typedef void (*bit_array_kernel)(bit_word* rp, size_t ro, const bit_word* xp, size_t xo, const bit_word* yp, size_t yo, size_t d);
+
+template <int OP>
+static void bit_array_op_generic(bit_word* rp, size_t ro, const bit_word* xp, size_t xo, const bit_word* yp, size_t yo, size_t d) {
+  bit_array_op_kernel<OP>(rp, ro, xp, xo, yp, yo, d);
 }
 
-template <typename Pointer, typename Index, typename Offset, typename Value>
-inline void store_byte32(Pointer pointer, Index index, Offset offset, Value value) {
-  set_low32((pointer)[index], 32 - (offset), (value) >> (offset));
-  set_high32((pointer)[(index)+1], offset, (value) << (32 - (offset)));
+#define BIT_ARRAY_KERNELS(fn) { \
+    fn<0>, fn<1>, fn<2>,  fn<3>,  fn<4>,  fn<5>,  fn<6>,  fn<7>, \
+    fn<8>, fn<9>, fn<10>, fn<11>, fn<12>, fn<13>, fn<14>, fn<15> }
+
+static const bit_array_kernel generic_bit_array_kernels[boolOpsMax] = BIT_ARRAY_KERNELS(bit_array_op_generic);
+
+#if defined(__x86_64__)
+// The same kernels compiled for 256 bit vectors, used when the processor has them
+template <int OP>
+__attribute__((target("avx2")))
+static void bit_array_op_avx2(bit_word* rp, size_t ro, const bit_word* xp, size_t xo, const bit_word* yp, size_t yo, size_t d) {
+  bit_array_op_kernel<OP>(rp, ro, xp, xo, yp, yo, d);
 }
 
-//#define TEMPLATE_BIT_ARRAY_OP 1
-#ifndef TEMPLATE_BIT_ARRAY_OP
+static const bit_array_kernel avx2_bit_array_kernels[boolOpsMax] = BIT_ARRAY_KERNELS(bit_array_op_avx2);
+#endif
+
+static const bit_array_kernel* bit_array_kernels() {
+#if defined(__x86_64__)
+  if (cpu_has_avx2()) return avx2_bit_array_kernels;
+#endif
+  return generic_bit_array_kernels;
+}
 
 class Dispatcher
 {
@@ -503,19 +738,18 @@ CL_LAMBDA(op x y &optional r);
 CL_DECLARE();
 CL_DOCSTRING("bitArrayOp");
 CL_DEFUN T_sp core__bit_array_op(int opval, Array_sp tx, Array_sp ty, T_sp tr) {
-  gctools::Fixnum i, j, n, d;
+  gctools::Fixnum i, d;
   SimpleBitVector_sp r0;
   size_t startr0 = 0;
-  bit_operator op;
   bool replace = false;
-  byte64_t xi, yi, ri;
-  byte32_t *xp, *yp, *rp;
-  byte64_t xo, yo, ro;
+  bit_word *xp, *yp, *rp;
+  size_t xo, yo, ro;
   AbstractSimpleVector_sp ax;
   size_t startx, endx;
   AbstractSimpleVector_sp ay;
   size_t starty, endy;
   Dispatcher dispatcher;
+  const bit_array_kernel* kernels = bit_array_kernels();
   Array_sp array_x = gc::As<Array_sp>(tx);
   array_x->asAbstractSimpleVectorRange(ax, startx, endx);
   SimpleBitVector_sp x = gc::As_unsafe<SimpleBitVector_sp>(ax);
@@ -543,6 +777,8 @@ CL_DEFUN T_sp core__bit_array_op(int opval, Array_sp tx, Array_sp ty, T_sp tr) {
     }
     if (endr-startr != d) //(r->arrayTotalSize() != d)
       goto ERROR;
+    // A result that overlaps x or y at a different bit offset would be
+    // overwritten before it is read, compute into a fresh vector and copy.
     i = (r->bytes()-xp)*32+startr-xo;
     if ((i > 0 && i < d) || (i < 0 && -i < d)) {
       r0 = r;
@@ -567,48 +803,10 @@ L1:
   }
   rp = r->bytes();
   ro = startr; // r->offset();
-  op = fixnum_operations[opval];
-
-  //
-  if (xo == 0 && yo == 0 && ro == 0) {
-    for (n = d / 32, i = 0; i < n; i++) {
-      rp[i] = (*op)(xp[i], yp[i]);
-    }
-    if ((j = d % 32) > 0) {
-      byte64_t rpt = (*op)(xp[n], yp[n]);
-      set_high32(rp[n], j, rpt);
-    }
-    if (!replace)
-      return dispatcher.dispatcher(&(* tx),r);
-  } else {
-    for (n = d / 32, i = 0; i <= n; i++) {
-      extract_byte32(xi, xp, i, xo);
-      extract_byte32(yi, yp, i, yo);
-      if (i == n) {
-        if ((j = d % 32) == 0)
-          break;
-        extract_byte32(ri, rp, n, ro);
-        set_high32(ri, j, (*op)(xi, yi));
-      } else {
-        ri = (*op)(xi, yi);
-      }
-      store_byte32(rp, i, ro, ri);
-    }
-    if (!replace)
-      return dispatcher.dispatcher(&(* tx),r);
-  }
-  rp = r0->bytes();
-  ro = startr0; // r0->offset();
-  for (n = d / 32, i = 0; i <= n; i++) {
-    if (i == n) {
-      if ((j = d % 32) == 0)
-        break;
-      extract_byte32(ri, rp, n, ro);
-      set_high32(ri, j, r->bytes()[n]);
-    } else
-      ri = r->bytes()[i];
-    store_byte32(rp, i, ro, ri);
-  }
+  (kernels[opval])(rp, ro, xp, xo, yp, yo, d);
+  if (!replace)
+    return dispatcher.dispatcher(&(* tx),r);
+  (kernels[b_1_op_id])(r0->bytes(), startr0, rp, 0, rp, 0, d);
   return dispatcher.dispatcher(&(* tx),r0);
 ERROR:
   SIMPLE_ERROR(BF("Illegal arguments for bit-array operation."));
@@ -633,152 +831,6 @@ CL_DEFUN T_sp core__bit_array_op_orc1_op(T_sp tx, T_sp ty, T_sp tr) { return cor
 CL_DEFUN T_sp core__bit_array_op_nand_op(T_sp tx, T_sp ty, T_sp tr) { return core__bit_array_op(nand_op_id,UA(tx),UA(ty),tr); };
 CL_DEFUN T_sp core__bit_array_op_b_set_op(T_sp tx, T_sp ty, T_sp tr) { return core__bit_array_op(b_set_op_id,UA(tx),UA(ty),tr); };
 
-#else
-template <int OP> struct do_bit_op {};
-template <> struct do_bit_op<b_clr_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_clr_op(i,j); };};
-template <> struct do_bit_op<and_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return and_op(i,j);};};
-template <> struct do_bit_op<andc2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return andc2_op(i,j);};};
-template <> struct do_bit_op<b_1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_1_op(i,j);};};
-template <> struct do_bit_op<andc1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return andc1_op(i,j);};};
-template <> struct do_bit_op<b_2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_2_op(i,j);};};
-template <> struct do_bit_op<xor_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return xor_op(i,j);};};
-template <> struct do_bit_op<ior_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return ior_op(i,j);};};
-template <> struct do_bit_op<nor_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return nor_op(i,j);};};
-template <> struct do_bit_op<eqv_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return eqv_op(i,j);};};
-template <> struct do_bit_op<b_c2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_c2_op(i,j);};};
-template <> struct do_bit_op<orc2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return orc2_op(i,j);};};
-template <> struct do_bit_op<b_c1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_c1_op(i,j);};};
-template <> struct do_bit_op<orc1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return orc1_op(i,j);};};
-template <> struct do_bit_op<nand_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return nand_op(i,j);};};
-template <> struct do_bit_op<b_set_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_set_op(i,j);};};
-
-template <int OP>
-T_sp template_bit_array_op(T_sp tx, T_sp ty, T_sp tr) {
-  gctools::Fixnum i, j, n, d;
-  SimpleBitVector_sp r0;
-  size_t startr0 = 0;
-  bit_operator op;
-  bool replace = false;
-  byte64_t xi, yi, ri;
-  byte32_t *xp, *yp, *rp;
-  byte64_t xo, yo, ro;
-  AbstractSimpleVector_sp ax;
-  size_t startx, endx;
-  AbstractSimpleVector_sp ay;
-  size_t starty, endy;
-  Array_sp array_x = gc::As<Array_sp>(tx);
-  array_x->asAbstractSimpleVectorRange(ax, startx, endx);
-  SimpleBitVector_sp x = gc::As_unsafe<SimpleBitVector_sp>(ax);
-  Array_sp array_y = gc::As<Array_sp>(ty);
-  array_y->asAbstractSimpleVectorRange(ay, starty, endy);
-  SimpleBitVector_sp y = gc::As_unsafe<SimpleBitVector_sp>(ay);
-  SimpleBitVector_sp r;
-  size_t startr, endr;
-  d = (endx - startx); // x->arrayTotalSize();
-  xp = x->bytes();
-  xo = startx; // x->offset();
-  if (d != array_y->arrayTotalSize())
-    goto ERROR;
-  yp = y->bytes();
-  yo = starty; // y->offset();
-  if (tr == _lisp->_true())
-    tr = x;
-  if (tr.notnilp()) {
-    AbstractSimpleVector_sp ar;
-    Array_sp array_r = gc::As<Array_sp>(tr);
-    array_r->asAbstractSimpleVectorRange(ar, startr, endr);
-    r = gc::As_unsafe<SimpleBitVector_sp>(ar);
-    if (!r) {
-      ERROR_WRONG_TYPE_NTH_ARG(core::_sym_bitArrayOp, 4, tr, cl::_sym_SimpleBitVector_O);
-    }
-    if (endr-startr != d) //(r->arrayTotalSize() != d)
-      goto ERROR;
-    i = (r->bytes()-xp)*32+startr-xo;
-    if ((i > 0 && i < d) || (i < 0 && -i < d)) {
-      r0 = r;
-      startr0 = startr;
-      tr = _Nil<T_O>();
-      replace = true;
-      goto L1;
-    }
-    i = (r->bytes() - yp) * 32 + (startr - yo);
-    if ((i > 0 && i < d) || (i < 0 && -i < d)) {
-      r0 = r;
-      startr0 = startr;
-      tr = _Nil<T_O>();
-      replace = true;
-    }
-  }
-L1:
-  if (tr.nilp()) {
-    startr = 0;
-    endr = d;
-    r = SimpleBitVector_O::make(d);
-  }
-  rp = r->bytes();
-  ro = startr; // r->offset();
-  if (xo == 0 && yo == 0 && ro == 0) {
-    for (n = d / 32, i = 0; i < n; i++) {
-      rp[i] = do_bit_op<OP>::do_it(xp[i], yp[i]);
-    }
-    if ((j = d % 32) > 0) {
-      byte64_t rpt = do_bit_op<OP>::do_it(xp[n], yp[n]);
-      set_high32(rp[n], j, rpt);
-    }
-    if (!replace)
-      return r;
-  } else {
-    for (n = d / 32, i = 0; i <= n; i++) {
-      extract_byte32(xi, xp, i, xo);
-      extract_byte32(yi, yp, i, yo);
-      if (i == n) {
-        if ((j = d % 32) == 0)
-          break;
-        extract_byte32(ri, rp, n, ro);
-        set_high32(ri, j, do_bit_op<OP>::do_it(xi, yi));
-      } else {
-        ri = do_bit_op<OP>::do_it(xi, yi);
-      }
-      store_byte32(rp, i, ro, ri);
-    }
-    if (!replace)
-      return r;
-  }
-  rp = r0->bytes();
-  ro = startr0; // r0->offset();
-  for (n = d / 32, i = 0; i <= n; i++) {
-    if (i == n) {
-      if ((j = d % 32) == 0)
-        break;
-      extract_byte32(ri, rp, n, ro);
-      set_high32(ri, j, r->bytes()[n]);
-    } else
-      ri = r->bytes()[i];
-    store_byte32(rp, i, ro, ri);
-  }
-  return r0;
-ERROR:
-  SIMPLE_ERROR(BF("Illegal arguments for bit-array operation."));
-}
-
-CL_DEFUN T_sp core__bit_array_op_b_clr_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<b_clr_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_and_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<and_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_andc2_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<andc2_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_b_1_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<b_1_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_andc1_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<andc1_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_b_2_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<b_2_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_xor_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<xor_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_ior_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<ior_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_nor_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<nor_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_eqv_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<eqv_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_b_c2_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<b_c2_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_orc2_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<orc2_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_b_c1_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<b_c1_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_orc1_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<orc1_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_nand_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<nand_op_id>(tx,ty,tr); };
-CL_DEFUN T_sp core__bit_array_op_b_set_op(T_sp tx, T_sp ty, T_sp tr) { return template_bit_array_op<b_set_op_id>(tx,ty,tr); };
-
-#endif
 #endif
 /*! Copied from ECL */
 CL_DEFUN T_sp cl__logbitp(Integer_sp p, Integer_sp x) {
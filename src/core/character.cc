@@ -62,23 +62,48 @@ inline int claspCharacter_basic_compare(claspCharacter na, claspCharacter nb) {
   return 1;
 }
 
-T_sp monotonic(int s, int t, List_sp args, bool preserve_case = true) {
-  claspCharacter c = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(args)));
-  if (!preserve_case) c = claspCharacter_upcase(c);
+static inline claspCharacter char_arg(T_sp arg, bool preserve_case) {
+  claspCharacter c = clasp_as_claspCharacter(gc::As<Character_sp>(arg));
+  return preserve_case ? c : claspCharacter_upcase(c);
+}
+
+T_sp monotonic(int s, int t, VaList_sp args, bool preserve_case = true) {
+  claspCharacter c = char_arg(args->next_arg(), preserve_case);
   claspCharacter d;
   int dir;
-  args = oCdr(args);
-  while (args.notnilp()) {
-    d = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(args)));
-    if (!preserve_case) d = claspCharacter_upcase(d);
+  while (args->remaining_nargs() > 0) {
+    d = char_arg(args->next_arg(), preserve_case);
     dir = s * claspCharacter_basic_compare(c, d);
     if (dir < t) return _Nil<T_O>();
     c = d;
-    args = oCdr(args);
   }
   return _lisp->_true();
 };
 
+/*! Pairwise comparison for char/= and char-not-equal, reads the arguments
+    in place so nothing is consed. */
+T_sp chars_all_different(VaList_sp args, bool preserve_case = true) {
+  size_t nargs = args->remaining_nargs();
+  for (size_t i = 0; i < nargs; ++i) {
+    claspCharacter a = char_arg(T_sp((gctools::Tagged)args->relative_indexed_arg(i)), preserve_case);
+    for (size_t j = i + 1; j < nargs; ++j) {
+      claspCharacter b = char_arg(T_sp((gctools::Tagged)args->relative_indexed_arg(j)), preserve_case);
+      if (a == b)
+        return _Nil<T_O>();
+    }
+  }
+  return _lisp->_true();
+}
+
+bool chars_all_same(VaList_sp args, bool preserve_case = true) {
+  claspCharacter a = char_arg(args->next_arg(), preserve_case);
+  while (args->remaining_nargs() > 0) {
+    if (a != char_arg(args->next_arg(), preserve_case))
+      return false;
+  }
+  return true;
+}
+
 CL_LAMBDA(arg);
 CL_DECLARE();
 CL_DOCSTRING("CLHS: graphic-char-p");
@@ -155,130 +180,103 @@ CL_DEFUN Character_sp cl__char_downcase(Character_sp ch) {
   return clasp_make_character(claspCharacter_downcase(clasp_as_claspCharacter(ch)));
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Return true if characters are monotonically increasing");
-CL_DEFUN T_sp cl__char_LT_(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_sp cl__char_LT_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return ((monotonic(-1, 1, args)));
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Return true if characters are monotonically decreasing");
-CL_DEFUN T_sp cl__char_GT_(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_sp cl__char_GT_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return ((monotonic(1, 1, args)));
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Return true if characters are monotonically non-decreasing");
-CL_DEFUN T_sp cl__char_LE_(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_sp cl__char_LE_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return (Values(monotonic(-1, 0, args)));
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Return true if characters are monotonically non-increasing");
-CL_DEFUN T_mv cl__char_GE_(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_mv cl__char_GE_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return (Values(monotonic(1, 0, args)));
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Return true if characters are monotonically increasing, ignore case");
-CL_DEFUN T_mv cl__char_lessp(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_mv cl__char_lessp(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return (Values(monotonic(-1, 1, args, false)));
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Return true if characters are monotonically decreasing, ignore case");
-CL_DEFUN T_mv cl__char_greaterp(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_mv cl__char_greaterp(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return (Values(monotonic(1, 1, args, false)));
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Return true if characters are monotonically non-increasing, ignore case");
-CL_DEFUN T_mv cl__char_not_greaterp(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_mv cl__char_not_greaterp(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return (Values(monotonic(-1, 0, args, false)));
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Return true if characters are monotonically non-decreasing, ignore case");
-CL_DEFUN T_sp cl__char_not_lessp(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_sp cl__char_not_lessp(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return ((monotonic(1, 0, args, false)));
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("NE_");
-CL_DEFUN T_sp cl__char_NE_(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_sp cl__char_NE_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
-  while (args.notnilp()) {
-    claspCharacter a = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(args)));
-    for (List_sp cur = oCdr(args); cur.notnilp(); cur = oCdr(cur)) {
-      claspCharacter b = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(cur)));
-      if (a == b)
-        return ((_Nil<T_O>()));
-    }
-    args = oCdr(args);
-  }
-  return ((_lisp->_true()));
+  return chars_all_different(args);
 }
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("EQ_");
-CL_DEFUN T_sp cl__char_EQ_(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_sp cl__char_EQ_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
-  claspCharacter a = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(args)));
-  args = oCdr(args);
-  while (args.notnilp()) {
-    claspCharacter b = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(args)));
-    if (a != b)
-      return ((_Nil<T_O>()));
-    args = oCdr(args);
-  }
-  return ((_lisp->_true()));
+  return chars_all_same(args) ? _lisp->_true() : _Nil<T_O>();
 };
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Like char_NE_ but ignore case");
-CL_DEFUN T_mv cl__char_not_equal(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_mv cl__char_not_equal(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
-  while (args.notnilp()) {
-    claspCharacter a = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(args)));
-    a = claspCharacter_upcase(a);
-    for (List_sp cur = oCdr(args); cur.notnilp(); cur = oCdr(cur)) {
-      claspCharacter b = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(cur)));
-      b = claspCharacter_upcase(b);
-      if (a == b) return (Values(_Nil<T_O>()));
-    }
-    args = oCdr(args);
-  }
-  return Values(_lisp->_true());
+  return Values(chars_all_different(args, false));
 }
 
 bool clasp_charEqual2(T_sp x, T_sp y) {
@@ -290,22 +288,13 @@ bool clasp_charEqual2(T_sp x, T_sp y) {
   return false;
 }
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("Like char_EQ_, ignore case");
-CL_DEFUN bool cl__char_equal(List_sp args) {
-  if (args.nilp())
+CL_DEFUN bool cl__char_equal(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
-  claspCharacter a = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(args)));
-  a = claspCharacter_upcase(a);
-  args = oCdr(args);
-  while (args.notnilp()) {
-    claspCharacter b = clasp_as_claspCharacter(gc::As<Character_sp>(oCar(args)));
-    b = claspCharacter_upcase(b);
-    if (a != b) return false;
-    args = oCdr(args);
-  }
-  return true;
+  return chars_all_same(args, false);
 };
 
 #define LINE_FEED_CHAR 10
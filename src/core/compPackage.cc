@@ -41,7 +41,6 @@ SYMBOL_EXPORT_SC_(CompPkg, STARthe_moduleSTAR);
 SYMBOL_EXPORT_SC_(CompPkg, STARlowLevelTracePrintSTAR);
 SYMBOL_EXPORT_SC_(CompPkg, jit_remove_module);
 SYMBOL_EXPORT_SC_(CompPkg, jit_register_symbol);
-SYMBOL_EXPORT_SC_(CompPkg, STARjit_saved_symbol_infoSTAR);
 SYMBOL_EXPORT_SC_(CompPkg, STARsave_module_for_disassembleSTAR);
 SYMBOL_EXPORT_SC_(CompPkg, STARsaved_module_from_clasp_jitSTAR);
 SYMBOL_EXPORT_SC_(CompPkg, optimize_module_for_compile);
@@ -507,6 +507,7 @@ LOAD:
   bool handleIt = if_dynamic_library_loaded_remove(name);
   //	printf("%s:%d Loading dynamic library: %s\n", __FILE__, __LINE__, name.c_str());
   void *handle = dlopen(name.c_str(), mode);
+  invalidate_library_symbol_indices();
   if (handle == NULL) {
     string error = dlerror();
     SIMPLE_ERROR(BF("Error in dlopen: %s") % error);
@@ -542,6 +543,7 @@ CL_DEFUN T_mv core__dlload(T_sp pathDesig) {
   string ts = pathWithProperExtension->asString();
   printf("%s:%d Loading with core__dlload %s\n", __FILE__, __LINE__, ts.c_str());
   void *handle = dlopen(ts.c_str(), mode);
+  invalidate_library_symbol_indices();
   if (handle == NULL) {
     string error = dlerror();
     return (Values(_Nil<T_O>(), SimpleBaseString_O::make(error)));
@@ -584,6 +586,7 @@ std::tuple< void *, string > do_dlopen(const string& str_path, const int n_mode)
   dlerror(); // clear any previous error
 
   p_handle = dlopen( str_path.c_str(), n_mode );
+  invalidate_library_symbol_indices();
 
   if ( ! p_handle ) {
     str_error = dlerror();
@@ -609,6 +612,7 @@ std::tuple< int, string > do_dlclose(void * p_handle) {
   }
   else {
     n_rc = dlclose( p_handle );
+    invalidate_library_symbol_indices();
 
     if ( n_rc != 0 ) {
       str_error = dlerror();
@@ -942,7 +942,7 @@ void CoreExposer_O::define_essential_globals(Lisp_sp lisp) {
   };
   /* Set the values of some essential global symbols */
   cl::_sym_nil = gctools::smart_ptr<core::Symbol_O>((gctools::Tagged)gctools::global_tagged_Symbol_OP_nil); //->initialize();
-  cl::_sym_nil->_Name = SimpleBaseString_O::make("NIL");
+  cl::_sym_nil->setf_name(SimpleBaseString_O::make("NIL"));
   //        printf("%s:%d About to add NIL to the COMMON-LISP package - is it defined at this point\n", __FILE__, __LINE__ );
   //	_lisp->_Roots._CommonLispPackage->add_symbol_to_package("NIL"cl::_sym_nil);
   cl::_sym_nil->_HomePackage = _lisp->_Roots._CommonLispPackage;
@@ -1113,13 +1113,6 @@ void CoreExposer_O::define_essential_globals(Lisp_sp lisp) {
 #endif
   _sym__PLUS_numberOfFixedArguments_PLUS_->defconstant(make_fixnum(LCC_ARGS_IN_REGISTERS));
   cl::_sym_STARrandom_stateSTAR->defparameter(RandomState_O::create());
-  // Set up a hash table to save JIT info
-  HashTableEqual_sp jit_save = HashTableEqual_O::create_default();
-#ifdef CLASP_THREADS
-  // When threading - make *jit-saved-symbol-info* a thread safe hash table
-  jit_save->_Mutex = mp::SharedMutex_O::make_shared_mutex(_Nil<T_O>());
-#endif
-  comp::_sym_STARjit_saved_symbol_infoSTAR->defparameter(jit_save);
   //
   comp::_sym_STARllvm_contextSTAR->defparameter(llvmo::LLVMContext_O::create_llvm_context());
   comp::_sym_STARload_time_value_holder_nameSTAR->defparameter(core::SimpleBaseString_O::make("[VALUES-TABLE]"));
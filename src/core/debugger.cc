@@ -35,6 +35,8 @@ THE SOFTWARE.
 #endif
 
 #include <csignal>
+#include <memory>
+#include <algorithm>
 #include <execinfo.h>
 #include <dlfcn.h>
 #include <clasp/core/foundation.h>
@@ -161,8 +163,15 @@ struct DebugInfo {
   map<std::string, OpenDynamicLibraryInfo> _OpenDynamicLibraryHandles;
   mp::SharedMutex                   _StackMapsLock;
   std::map<uintptr_t,StackMapRange> _StackMaps;
+  // Jitted objects are indexed by start address so that a return address
+  // can be mapped back to its function with one lower bound search.
+  // _JittedObjectsByName is used to find FunctionDescription objects and
+  // _JittedObjectsByOwner remembers which objects came from which
+  // object file so that they can be dropped when the module is removed.
   mp::SharedMutex                   _JittedObjectsLock;
-  std::vector<JittedObject>         _JittedObjects;
+  std::map<uintptr_t,JittedObject>  _JittedObjects;
+  std::map<std::string,uintptr_t>   _JittedObjectsByName;
+  std::map<void*,std::vector<uintptr_t>> _JittedObjectsByOwner;
   DebugInfo() {};
 };
 
@@ -193,6 +202,7 @@ bool if_dynamic_library_loaded_remove(const std::string& libraryName) {
   if (exists) {
     BT_LOG((buf,"What about the stackmaps for this library - you need to remove them as well - I should probably NOT store stackmaps for libraries - but fetch them every time we need a backtrace!\n"));
     dlclose(fi->second._Handle);
+    invalidate_library_symbol_indices();
     debugInfo()._OpenDynamicLibraryHandles.erase(libraryName);
   }
   return exists;
@@ -422,49 +432,115 @@ void search_jitted_stackmaps(gc::Vec0<BacktraceEntry>& backtrace)
 }
 
 
-void register_jitted_object(const std::string& name, uintptr_t address, int size) {
+void register_jitted_object(const std::string& name, uintptr_t address, int size, void* owner) {
   BT_LOG((buf,"Starting\n" ));
   LOG(BF("STACKMAP_LOG  %s name: %s %p %d\n") % __FUNCTION__ % name % (void*)address % size );
-  WITH_READ_WRITE_LOCK(debugInfo()._JittedObjectsLock);
-  debugInfo()._JittedObjects.emplace_back(JittedObject(name,address,size));
+  if (size<=0 || name.size()==0) return;
+  DebugInfo& info = debugInfo();
+  WITH_READ_WRITE_LOCK(info._JittedObjectsLock);
+  std::map<uintptr_t,JittedObject>::iterator it = info._JittedObjects.find(address);
+  // Several symbols can share a start address (a section symbol and the first
+  // function in it) - keep the tightest one so the intervals stay disjoint.
+  if (it!=info._JittedObjects.end() && it->second._Size<=size) return;
+  info._JittedObjects[address] = JittedObject(name,address,size);
+  info._JittedObjectsByName[name] = address;
+  if (owner) info._JittedObjectsByOwner[owner].push_back(address);
+}
+
+void unregister_jitted_objects(void* owner) {
+  DebugInfo& info = debugInfo();
+  WITH_READ_WRITE_LOCK(info._JittedObjectsLock);
+  std::map<void*,std::vector<uintptr_t>>::iterator owned = info._JittedObjectsByOwner.find(owner);
+  if (owned==info._JittedObjectsByOwner.end()) return;
+  for ( auto address : owned->second ) {
+    std::map<uintptr_t,JittedObject>::iterator it = info._JittedObjects.find(address);
+    if (it==info._JittedObjects.end()) continue;
+    std::map<std::string,uintptr_t>::iterator named = info._JittedObjectsByName.find(it->second._Name);
+    if (named!=info._JittedObjectsByName.end() && named->second==address) {
+      info._JittedObjectsByName.erase(named);
+    }
+    info._JittedObjects.erase(it);
+  }
+  info._JittedObjectsByOwner.erase(owned);
+}
+
+/*! Find the jitted object whose extent contains address - the caller must hold _JittedObjectsLock */
+static const JittedObject* find_jitted_object_no_lock(uintptr_t address) {
+  DebugInfo& info = debugInfo();
+  std::map<uintptr_t,JittedObject>::const_iterator it = info._JittedObjects.upper_bound(address);
+  if (it==info._JittedObjects.begin()) return NULL;
+  --it;
+  if (address < it->second._ObjectPointer+it->second._Size) return &it->second;
+  return NULL;
+}
+
+bool lookup_jitted_object(uintptr_t address, std::string& name, uintptr_t& start, size_t& size) {
+  WITH_READ_LOCK(debugInfo()._JittedObjectsLock);
+  const JittedObject* entry = find_jitted_object_no_lock(address);
+  if (!entry) return false;
+  name = entry->_Name;
+  start = entry->_ObjectPointer;
+  size = entry->_Size;
+  return true;
+}
+
+bool lookup_jitted_object_named(const std::string& name, uintptr_t& start, size_t& size) {
+  DebugInfo& info = debugInfo();
+  WITH_READ_LOCK(info._JittedObjectsLock);
+  std::map<std::string,uintptr_t>::const_iterator named = info._JittedObjectsByName.find(name);
+  if (named==info._JittedObjectsByName.end()) return false;
+  std::map<uintptr_t,JittedObject>::const_iterator it = info._JittedObjects.find(named->second);
+  if (it==info._JittedObjects.end()) return false;
+  start = it->second._ObjectPointer;
+  size = it->second._Size;
+  return true;
 }
 
 void search_jitted_objects(gc::Vec0<BacktraceEntry>& backtrace, bool searchFunctionDescriptions)
 {
   BT_LOG((buf,"Starting search_jitted_objects\n" ));
-  WITH_READ_LOCK(debugInfo()._JittedObjectsLock);
-  for ( auto entry : debugInfo()._JittedObjects ) {
-    BT_LOG((buf,"Looking at jitted object name: %s @%p size: %d\n", entry._Name.c_str(), (void*)entry._ObjectPointer, entry._Size));
-    if (backtrace.size()==0 && !searchFunctionDescriptions) {
-      WRITE_DEBUG_IO(BF("Jitted-object object-start %p object-end %p name %s\n") % (void*)entry._ObjectPointer % (void*)(entry._ObjectPointer+entry._Size) % entry._Name);
+  DebugInfo& info = debugInfo();
+  WITH_READ_LOCK(info._JittedObjectsLock);
+  if (backtrace.size()==0 && !searchFunctionDescriptions) {
+    for ( auto& entry : info._JittedObjects ) {
+      WRITE_DEBUG_IO(BF("Jitted-object object-start %p object-end %p name %s\n") % (void*)entry.second._ObjectPointer % (void*)(entry.second._ObjectPointer+entry.second._Size) % entry.second._Name);
     }
-    for (size_t j=0; j<backtrace.size(); ++j ) {
-      BT_LOG((buf, "Comparing to backtrace frame %lu  return address %p %s\n", j, (void*)backtrace[j]._ReturnAddress, backtrace_frame(j,&backtrace[j]).c_str()));
-      if (!searchFunctionDescriptions && backtrace[j]._Stage != symbolicated) {
-        if (entry._ObjectPointer<=backtrace[j]._ReturnAddress && backtrace[j]._ReturnAddress<(entry._ObjectPointer+entry._Size)) {
-          backtrace[j]._Stage = lispFrame; // jitted functions are lisp functions
-          backtrace[j]._FunctionStart = entry._ObjectPointer;
-          backtrace[j]._FunctionEnd = entry._ObjectPointer+entry._Size;
-          backtrace[j]._SymbolName = entry._Name;
-          BT_LOG((buf,"MATCHED!!!\n"));
-          break;
-        }
+    return;
+  }
+  for (size_t j=0; j<backtrace.size(); ++j ) {
+    BT_LOG((buf, "Looking up backtrace frame %lu  return address %p %s\n", j, (void*)backtrace[j]._ReturnAddress, backtrace_frame(j,&backtrace[j]).c_str()));
+    if (!searchFunctionDescriptions && backtrace[j]._Stage != symbolicated) {
+      const JittedObject* entry = find_jitted_object_no_lock(backtrace[j]._ReturnAddress);
+      if (entry) {
+        backtrace[j]._Stage = lispFrame; // jitted functions are lisp functions
+        backtrace[j]._FunctionStart = entry->_ObjectPointer;
+        backtrace[j]._FunctionEnd = entry->_ObjectPointer+entry->_Size;
+        backtrace[j]._SymbolName = entry->_Name;
+        BT_LOG((buf,"MATCHED!!!\n"));
       }
-      if (searchFunctionDescriptions && entry._Size == sizeof(FunctionDescription) && backtrace[j]._Stage == lispFrame) {
-        stringstream ss;
-        ss << backtrace[j]._SymbolName;
-        ss << "^DESC";
-        if (ss.str() == entry._Name) {
-          backtrace[j]._Stage = lispFrame; // Anything with a FunctionDescription is a lispFrame
-          backtrace[j]._FunctionDescription = entry._ObjectPointer;
+    }
+    if (searchFunctionDescriptions && backtrace[j]._Stage == lispFrame) {
+      stringstream ss;
+      ss << backtrace[j]._SymbolName;
+      ss << "^DESC";
+      std::map<std::string,uintptr_t>::const_iterator named = info._JittedObjectsByName.find(ss.str());
+      if (named!=info._JittedObjectsByName.end()) {
+        std::map<uintptr_t,JittedObject>::const_iterator it = info._JittedObjects.find(named->second);
+        if (it!=info._JittedObjects.end() && it->second._Size == sizeof(FunctionDescription)) {
+          backtrace[j]._FunctionDescription = it->second._ObjectPointer;
           BT_LOG((buf,"MATCHED!!!\n"));
-          break;
         }
       }
     }
   }
 }
 
+CL_DOCSTRING("Write the start, end and name of every registered jitted object to *debug-io*");
+CL_DEFUN void core__dump_jitted_objects() {
+  gc::Vec0<BacktraceEntry> empty;
+  search_jitted_objects(empty,false);
+}
+
 #if 0
 bool lookup_stack_map_entry(uintptr_t functionPointer, int& frameOffset, int& frameSize) {
   ensure_global_StackMapInfo();
@@ -916,6 +992,8 @@ void walk_loaded_objects(gc::Vec0<BacktraceEntry>& backtrace) {
 #ifdef _TARGET_OS_LINUX
 
 
+extern "C" char* __progname_full; // The name of the executable?
+
 std::atomic<bool> global_elf_initialized;
 void ensure_libelf_initialized() {
   if (!global_elf_initialized) {
@@ -924,123 +1002,211 @@ void ensure_libelf_initialized() {
   }
 }
 
-void scan_elf_library_for_symbols_then_stackmaps(gc::Vec0<BacktraceEntry>&backtrace, const std::string& filename, uintptr_t start)
+/*! A sorted address->symbol index for one loaded ELF library.
+    Built the first time a backtrace passes through the library and kept in
+    debugInfo() until a library is dlopen'd or dlclose'd. */
+struct ElfFunctionSymbol {
+  uintptr_t   _Start;
+  uintptr_t   _End;
+  std::string _Name;
+  ElfFunctionSymbol(uintptr_t s, uintptr_t e, const std::string& n) : _Start(s), _End(e), _Name(n) {};
+  bool operator<(const ElfFunctionSymbol& other) const { return this->_Start < other._Start; };
+};
+
+struct ElfLibraryIndex {
+  std::vector<ElfFunctionSymbol>  _Functions;            // sorted by _Start
+  std::map<std::string,uintptr_t> _FunctionDescriptions; // "name^DESC" -> address
+  std::vector<std::pair<uintptr_t,uintptr_t>> _StackMaps;
+};
+
+struct ElfLibraryIndices {
+  mp::SharedMutex _Lock;
+  std::map<std::pair<std::string,uintptr_t>,std::shared_ptr<ElfLibraryIndex>> _Libraries;
+  ElfLibraryIndices() {};
+};
+
+ElfLibraryIndices& elfLibraryIndices() {
+  static ElfLibraryIndices* indices = new ElfLibraryIndices();
+  return *indices;
+}
+
+void invalidate_library_symbol_indices() {
+  ElfLibraryIndices& indices = elfLibraryIndices();
+  WITH_READ_WRITE_LOCK(indices._Lock);
+  indices._Libraries.clear();
+}
+
+std::shared_ptr<ElfLibraryIndex> build_elf_library_index(const std::string& filename, uintptr_t start)
 {
-  BT_LOG((buf,"Searching symbol table %s memory-start %p\n", filename.c_str(), (void*)start ));
+  BT_LOG((buf,"Indexing symbol table %s memory-start %p\n", filename.c_str(), (void*)start ));
+  std::shared_ptr<ElfLibraryIndex> index = std::make_shared<ElfLibraryIndex>();
   Elf         *elf;
   GElf_Shdr   shdr;
   Elf_Data    *data;
   int         fd, ii, count;
-  WRITE_DEBUG_IO(BF("Library %s\n") % filename );
   ensure_libelf_initialized();
-  elf_version(EV_CURRENT);
   fd = open(filename.c_str(), O_RDONLY);
   if (fd < 0) {
     BT_LOG((buf,"Could not open %s", filename.c_str()));
-    return;
+    return index;
   }
   if ((elf = elf_begin(fd, ELF_C_READ, NULL)) == NULL) {
     close(fd);
     SIMPLE_ERROR(BF("Error with elf_begin for file %s - %s") % filename % elf_errmsg(-1));
   }
+  size_t shstrndx;
+  if ( elf_getshdrstrndx (elf, &shstrndx ) != 0) {
+    elf_end(elf);
+    close(fd);
+    SIMPLE_ERROR(BF("elf_getshdrstrndx () failed : %s.") % elf_errmsg ( -1));
+  }
   Elf_Scn     *scn = NULL;
-  // Search the symbol tables for functions that contain the return address
-  scn = NULL;
   while ((scn = elf_nextscn(elf, scn)) != NULL) {
     gelf_getshdr(scn, &shdr);
-    BT_LOG((buf,"Looking at section\n" ));
     if (shdr.sh_type == SHT_SYMTAB) {
       data = elf_getdata(scn, NULL);
       count = shdr.sh_size / shdr.sh_entsize;
       BT_LOG((buf,"Found SYMTAB count: %d\n", count ));
-	/* Search the symbol names */
       for (ii = 0; ii < count; ++ii) {
         GElf_Sym sym;
         gelf_getsym(data, ii, &sym);
-        uintptr_t symbol_start = (uintptr_t)sym.st_value+start;
-        uintptr_t symbol_end = symbol_start+sym.st_size;
-        if (backtrace.size()==0) {
-          WRITE_DEBUG_IO(BF("Symbol start %p end %p name %s\n") % (void*)symbol_start % (void*)symbol_end % elf_strptr(elf,shdr.sh_link , (size_t)sym.st_name));
-        }
-        BT_LOG((buf,"Looking at symbol %s type: %d\n", elf_strptr(elf,shdr.sh_link , (size_t)sym.st_name), ELF64_ST_TYPE(sym.st_info)));
+        if (sym.st_size == 0) continue;
         if (ELF64_ST_TYPE(sym.st_info) == STT_FUNC) {
-          BT_LOG((buf,"It's a function symbol\n" ));
-          for ( size_t j=0; j<backtrace.size(); ++j ) {
-            if (backtrace[j]._Stage==undefined) {
-              if (symbol_start<=backtrace[j]._ReturnAddress && backtrace[j]._ReturnAddress<symbol_end) {
-                backtrace[j]._Stage = symbolicated;
-                backtrace[j]._FunctionStart = symbol_start;
-                backtrace[j]._FunctionEnd = symbol_start+(uintptr_t)sym.st_size;
-                backtrace[j]._SymbolName = elf_strptr(elf,shdr.sh_link , (size_t)sym.st_name);
-                BT_LOG((buf,"Identified symbol name %s for frame %lu\n", backtrace[j]._SymbolName.c_str(), j));
-                break;
-              }
-            }
+          uintptr_t symbol_start = (uintptr_t)sym.st_value+start;
+          index->_Functions.emplace_back(symbol_start,symbol_start+(uintptr_t)sym.st_size,
+                                         elf_strptr(elf,shdr.sh_link,(size_t)sym.st_name));
+        } else if (ELF64_ST_TYPE(sym.st_info) == STT_OBJECT && sym.st_size == sizeof(FunctionDescription)) { // a quick way to identify FunctionDescriptions
+          const char* symname = elf_strptr(elf,shdr.sh_link,(size_t)sym.st_name);
+          size_t len = strlen(symname);
+          if (len>5 && strcmp(symname+len-5,"^DESC")==0) {
+            index->_FunctionDescriptions[symname] = (uintptr_t)sym.st_value+start;
           }
         }
       }
-    } 
+    } else {
+      const char* name = elf_strptr(elf, shstrndx, shdr.sh_name);
+      if (name && strncmp(name,".llvm_stackmaps",strlen(".llvm_stackmaps"))==0) {
+        uintptr_t addr = shdr.sh_addr+start;
+        index->_StackMaps.emplace_back(addr,addr+shdr.sh_size);
+      }
+    }
   }
-  scn = NULL;
-  // Search the symbol tables for FunctionDescription objects
-  while ((scn = elf_nextscn(elf, scn)) != NULL) {
-    gelf_getshdr(scn, &shdr);
-    BT_LOG((buf,"Looking at section\n" ));
-    if (shdr.sh_type == SHT_SYMTAB) {
-      data = elf_getdata(scn, NULL);
-      count = shdr.sh_size / shdr.sh_entsize;
-      BT_LOG((buf,"Found SYMTAB count: %d\n", count ));
-	/* Search the symbol names */
-      for (ii = 0; ii < count; ++ii) {
-        GElf_Sym sym;
-        gelf_getsym(data, ii, &sym);
-        BT_LOG((buf,"Looking at symbol %s type: %d\n", elf_strptr(elf,shdr.sh_link , (size_t)sym.st_name), ELF64_ST_TYPE(sym.st_info)));
-        if (ELF64_ST_TYPE(sym.st_info) == STT_OBJECT && sym.st_size == sizeof(FunctionDescription)) { // a quick way to identify FunctionDescriptions
-          BT_LOG((buf,"It may be a FunctionDescription symbol\n" ));
-          for ( size_t j=0; j<backtrace.size(); ++j ) {
-            if (backtrace[j]._Stage==symbolicated) {
-              const char* symname = elf_strptr(elf,shdr.sh_link , (size_t)sym.st_name);
-              stringstream ss;
-              ss << backtrace[j]._SymbolName
-                 << "^DESC";
-              if (ss.str() == symname) {
-                uintptr_t symbol_start = (uintptr_t)sym.st_value+start;
-                backtrace[j]._Stage = lispFrame; // anything with a FunctionDescription is a LispFrame
-                backtrace[j]._FunctionDescription = symbol_start;
-              }
-            }
-          }
-        }
+  elf_end(elf);
+  close(fd);
+  // stable_sort keeps the first of several symbols at one address (symtab order)
+  std::stable_sort(index->_Functions.begin(),index->_Functions.end());
+  return index;
+}
+
+std::shared_ptr<ElfLibraryIndex> elf_library_index(const std::string& filename, uintptr_t start)
+{
+  ElfLibraryIndices& indices = elfLibraryIndices();
+  std::pair<std::string,uintptr_t> key(filename,start);
+  {
+    WITH_READ_LOCK(indices._Lock);
+    auto found = indices._Libraries.find(key);
+    if (found!=indices._Libraries.end()) return found->second;
+  }
+  std::shared_ptr<ElfLibraryIndex> index = build_elf_library_index(filename,start);
+  WITH_READ_WRITE_LOCK(indices._Lock);
+  indices._Libraries[key] = index;
+  return index;
+}
+
+const ElfFunctionSymbol* find_elf_function(const ElfLibraryIndex& index, uintptr_t address)
+{
+  auto it = std::upper_bound(index._Functions.begin(),index._Functions.end(),
+                             ElfFunctionSymbol(address,address,""));
+  if (it==index._Functions.begin()) return NULL;
+  --it;
+  // Back up over symbols that share this start address to the first one in symtab order
+  while (it!=index._Functions.begin() && (it-1)->_Start==it->_Start) --it;
+  if (address < it->_End) return &*it;
+  return NULL;
+}
+
+struct FindLibraryInfo {
+  uintptr_t   _Address;
+  bool        _Found;
+  std::string _Filename;
+  uintptr_t   _Start;
+  FindLibraryInfo(uintptr_t address) : _Address(address), _Found(false), _Start(0) {};
+};
+
+int find_library_callback(struct dl_phdr_info *info, size_t size, void* data)
+{
+  FindLibraryInfo* find = (FindLibraryInfo*)data;
+  for ( int i=0; i<info->dlpi_phnum; ++i ) {
+    const ElfW(Phdr)& phdr = info->dlpi_phdr[i];
+    if (phdr.p_type != PT_LOAD) continue;
+    uintptr_t segment_start = info->dlpi_addr+phdr.p_vaddr;
+    if (segment_start<=find->_Address && find->_Address<segment_start+phdr.p_memsz) {
+      find->_Found = true;
+      find->_Filename = (strlen(info->dlpi_name)==0) ? __progname_full : info->dlpi_name;
+      find->_Start = info->dlpi_addr;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+bool lookup_library_function(uintptr_t address, std::string& name, uintptr_t& start)
+{
+  FindLibraryInfo find(address);
+  dl_iterate_phdr(find_library_callback,&find);
+  if (!find._Found) return false;
+  std::shared_ptr<ElfLibraryIndex> index = elf_library_index(find._Filename,find._Start);
+  const ElfFunctionSymbol* symbol = find_elf_function(*index,address);
+  if (!symbol) return false;
+  name = symbol->_Name;
+  start = symbol->_Start;
+  return true;
+}
+
+void scan_elf_library_for_symbols_then_stackmaps(gc::Vec0<BacktraceEntry>&backtrace, const std::string& filename, uintptr_t start)
+{
+  BT_LOG((buf,"Searching symbol table %s memory-start %p\n", filename.c_str(), (void*)start ));
+  std::shared_ptr<ElfLibraryIndex> index = elf_library_index(filename,start);
+  if (backtrace.size()==0) {
+    WRITE_DEBUG_IO(BF("Library %s\n") % filename );
+    for ( auto& symbol : index->_Functions ) {
+      WRITE_DEBUG_IO(BF("Symbol start %p end %p name %s\n") % (void*)symbol._Start % (void*)symbol._End % symbol._Name);
+    }
+  }
+  // Symbolicate the frames whose return address falls within a function of this library
+  for ( size_t j=0; j<backtrace.size(); ++j ) {
+    if (backtrace[j]._Stage==undefined) {
+      const ElfFunctionSymbol* symbol = find_elf_function(*index,backtrace[j]._ReturnAddress);
+      if (symbol) {
+        backtrace[j]._Stage = symbolicated;
+        backtrace[j]._FunctionStart = symbol->_Start;
+        backtrace[j]._FunctionEnd = symbol->_End;
+        backtrace[j]._SymbolName = symbol->_Name;
+        BT_LOG((buf,"Identified symbol name %s for frame %lu\n", backtrace[j]._SymbolName.c_str(), j));
       }
     }
   }
-  scn = NULL ;
-  const char * name , *p;
-  size_t n , shstrndx , sz ;
-  if ( elf_getshdrstrndx (elf, &shstrndx ) != 0)
-    SIMPLE_ERROR(BF("elf_getshdrstrndx () failed : %s.") % elf_errmsg ( -1));
-  while (( scn = elf_nextscn (elf, scn )) != NULL ) { 
-    if ( gelf_getshdr ( scn, &shdr ) != & shdr )
-      SIMPLE_ERROR(BF("getshdr() failed : %s.") % elf_errmsg ( -1));
-    if (( name = elf_strptr (elf, shstrndx, shdr.sh_name )) == NULL ) 
-      SIMPLE_ERROR(BF("stackmaps elf_strptr() failed : %s.") % elf_errmsg ( -1));
-    if (strncmp(name,".llvm_stackmaps",strlen(".llvm_stackmaps"))==0) {
-      uintptr_t addr = shdr.sh_addr+start;
-      uintptr_t stackmap_end = addr + shdr.sh_size;
-	//      ( void ) printf ( "Section %-4.4jd %s address: %lu offset: %lu  size: %lu\n", ( uintmax_t )
-	//                        elf_ndxscn ( scn ), name, shdr.sh_addr, shdr.sh_offset, shdr.sh_size );
-      while (addr<stackmap_end) {
-        BT_LOG((buf," Stackmap start at %p\n", (void*)addr));
-        walk_one_llvm_stackmap(backtrace,addr,stackmap_end,true);
+  // Attach FunctionDescription objects
+  if (index->_FunctionDescriptions.size()>0) {
+    for ( size_t j=0; j<backtrace.size(); ++j ) {
+      if (backtrace[j]._Stage==symbolicated) {
+        auto desc = index->_FunctionDescriptions.find(backtrace[j]._SymbolName+"^DESC");
+        if (desc!=index->_FunctionDescriptions.end()) {
+          backtrace[j]._Stage = lispFrame; // anything with a FunctionDescription is a LispFrame
+          backtrace[j]._FunctionDescription = desc->second;
+        }
       }
     }
   }
-  elf_end(elf);
-  close(fd);
+  for ( auto& range : index->_StackMaps ) {
+    uintptr_t addr = range.first;
+    while (addr<range.second) {
+      BT_LOG((buf," Stackmap start at %p\n", (void*)addr));
+      walk_one_llvm_stackmap(backtrace,addr,range.second,true);
+    }
+  }
 }
 
-  
-extern "C" char* __progname_full; // The name of the executable?
 
 int elf_loaded_object_callback(struct dl_phdr_info *info, size_t size, void* data)
 {
@@ -1059,6 +1225,14 @@ int elf_loaded_object_callback(struct dl_phdr_info *info, size_t size, void* dat
   return 0;
 }
 
+#else
+
+void invalidate_library_symbol_indices() {};
+
+bool lookup_library_function(uintptr_t address, std::string& name, uintptr_t& start) {
+  return false;
+}
+
 #endif
 
 void start_debugger() {
@@ -227,16 +227,274 @@ change_precision(float_approx *approx, T_sp tposition, T_sp relativep) {
   }
 }
 
+/* ----------------------------------------------------------------------
+ * Shortest digits with fixed size integers (Grisu3, Loitsch 2010).
+ * The value and its rounding boundaries are scaled by a cached power of
+ * ten into 64 bit fixed point and the digits are generated with machine
+ * arithmetic.  For about 0.5% of doubles the result can't be proven
+ * shortest and closest - grisu3 returns false and the caller falls back
+ * to the bignum algorithm above, so the output is always the same.
+ */
+
+struct diy_fp {
+  uint64_t f;
+  int e;
+};
+
+static inline diy_fp diy_fp_multiply(diy_fp x, diy_fp y) {
+  __uint128_t p = (__uint128_t)x.f * y.f;
+  diy_fp r;
+  r.f = (uint64_t)(p >> 64) + (uint64_t)(((uint64_t)p) >> 63);
+  r.e = x.e + y.e + 64;
+  return r;
+}
+
+static inline diy_fp diy_fp_normalize(diy_fp x) {
+  int shift = __builtin_clzll(x.f);
+  x.f <<= shift;
+  x.e -= shift;
+  return x;
+}
+
+struct cached_power {
+  uint64_t significand;
+  int16_t binary_exponent;
+  int16_t decimal_exponent;
+};
+
+/* 10^k for k = -348, -340, ..., 340 rounded to 64 bits */
+static const cached_power cached_powers[] = {
+  {0xfa8fd5a0081c0288ULL, -1220, -348},
+  {0xbaaee17fa23ebf76ULL, -1193, -340},
+  {0x8b16fb203055ac76ULL, -1166, -332},
+  {0xcf42894a5dce35eaULL, -1140, -324},
+  {0x9a6bb0aa55653b2dULL, -1113, -316},
+  {0xe61acf033d1a45dfULL, -1087, -308},
+  {0xab70fe17c79ac6caULL, -1060, -300},
+  {0xff77b1fcbebcdc4fULL, -1034, -292},
+  {0xbe5691ef416bd60cULL, -1007, -284},
+  {0x8dd01fad907ffc3cULL, -980, -276},
+  {0xd3515c2831559a83ULL, -954, -268},
+  {0x9d71ac8fada6c9b5ULL, -927, -260},
+  {0xea9c227723ee8bcbULL, -901, -252},
+  {0xaecc49914078536dULL, -874, -244},
+  {0x823c12795db6ce57ULL, -847, -236},
+  {0xc21094364dfb5637ULL, -821, -228},
+  {0x9096ea6f3848984fULL, -794, -220},
+  {0xd77485cb25823ac7ULL, -768, -212},
+  {0xa086cfcd97bf97f4ULL, -741, -204},
+  {0xef340a98172aace5ULL, -715, -196},
+  {0xb23867fb2a35b28eULL, -688, -188},
+  {0x84c8d4dfd2c63f3bULL, -661, -180},
+  {0xc5dd44271ad3cdbaULL, -635, -172},
+  {0x936b9fcebb25c996ULL, -608, -164},
+  {0xdbac6c247d62a584ULL, -582, -156},
+  {0xa3ab66580d5fdaf6ULL, -555, -148},
+  {0xf3e2f893dec3f126ULL, -529, -140},
+  {0xb5b5ada8aaff80b8ULL, -502, -132},
+  {0x87625f056c7c4a8bULL, -475, -124},
+  {0xc9bcff6034c13053ULL, -449, -116},
+  {0x964e858c91ba2655ULL, -422, -108},
+  {0xdff9772470297ebdULL, -396, -100},
+  {0xa6dfbd9fb8e5b88fULL, -369, -92},
+  {0xf8a95fcf88747d94ULL, -343, -84},
+  {0xb94470938fa89bcfULL, -316, -76},
+  {0x8a08f0f8bf0f156bULL, -289, -68},
+  {0xcdb02555653131b6ULL, -263, -60},
+  {0x993fe2c6d07b7facULL, -236, -52},
+  {0xe45c10c42a2b3b06ULL, -210, -44},
+  {0xaa242499697392d3ULL, -183, -36},
+  {0xfd87b5f28300ca0eULL, -157, -28},
+  {0xbce5086492111aebULL, -130, -20},
+  {0x8cbccc096f5088ccULL, -103, -12},
+  {0xd1b71758e219652cULL, -77, -4},
+  {0x9c40000000000000ULL, -50, 4},
+  {0xe8d4a51000000000ULL, -24, 12},
+  {0xad78ebc5ac620000ULL, 3, 20},
+  {0x813f3978f8940984ULL, 30, 28},
+  {0xc097ce7bc90715b3ULL, 56, 36},
+  {0x8f7e32ce7bea5c70ULL, 83, 44},
+  {0xd5d238a4abe98068ULL, 109, 52},
+  {0x9f4f2726179a2245ULL, 136, 60},
+  {0xed63a231d4c4fb27ULL, 162, 68},
+  {0xb0de65388cc8ada8ULL, 189, 76},
+  {0x83c7088e1aab65dbULL, 216, 84},
+  {0xc45d1df942711d9aULL, 242, 92},
+  {0x924d692ca61be758ULL, 269, 100},
+  {0xda01ee641a708deaULL, 295, 108},
+  {0xa26da3999aef774aULL, 322, 116},
+  {0xf209787bb47d6b85ULL, 348, 124},
+  {0xb454e4a179dd1877ULL, 375, 132},
+  {0x865b86925b9bc5c2ULL, 402, 140},
+  {0xc83553c5c8965d3dULL, 428, 148},
+  {0x952ab45cfa97a0b3ULL, 455, 156},
+  {0xde469fbd99a05fe3ULL, 481, 164},
+  {0xa59bc234db398c25ULL, 508, 172},
+  {0xf6c69a72a3989f5cULL, 534, 180},
+  {0xb7dcbf5354e9beceULL, 561, 188},
+  {0x88fcf317f22241e2ULL, 588, 196},
+  {0xcc20ce9bd35c78a5ULL, 614, 204},
+  {0x98165af37b2153dfULL, 641, 212},
+  {0xe2a0b5dc971f303aULL, 667, 220},
+  {0xa8d9d1535ce3b396ULL, 694, 228},
+  {0xfb9b7cd9a4a7443cULL, 720, 236},
+  {0xbb764c4ca7a44410ULL, 747, 244},
+  {0x8bab8eefb6409c1aULL, 774, 252},
+  {0xd01fef10a657842cULL, 800, 260},
+  {0x9b10a4e5e9913129ULL, 827, 268},
+  {0xe7109bfba19c0c9dULL, 853, 276},
+  {0xac2820d9623bf429ULL, 880, 284},
+  {0x80444b5e7aa7cf85ULL, 907, 292},
+  {0xbf21e44003acdd2dULL, 933, 300},
+  {0x8e679c2f5e44ff8fULL, 960, 308},
+  {0xd433179d9c8cb841ULL, 986, 316},
+  {0x9e19db92b4e31ba9ULL, 1013, 324},
+  {0xeb96bf6ebadf77d9ULL, 1039, 332},
+  {0xaf87023b9bf0ee6bULL, 1066, 340}
+};
+
+#define CACHED_POWERS_OFFSET 348
+#define CACHED_POWERS_DISTANCE 8
+/* The scaled value must have its binary exponent in this range so that
+   the integral part fits in 32 bits */
+#define GRISU_MIN_TARGET_EXPONENT -60
+#define GRISU_MAX_TARGET_EXPONENT -32
+
+static void cached_power_for_binary_exponent(int min_exponent, diy_fp &power, int &decimal_exponent) {
+  double k = ceil((min_exponent + 63) * 0.30102999566398114);
+  int index = (CACHED_POWERS_OFFSET + (int)k - 1) / CACHED_POWERS_DISTANCE + 1;
+  const cached_power &cached = cached_powers[index];
+  power.f = cached.significand;
+  power.e = cached.binary_exponent;
+  decimal_exponent = cached.decimal_exponent;
+}
+
+/* Walk the last digit down towards w while that stays inside the
+   interval, then check that the result is provably the closest */
+static bool round_weed(char *buffer, int length, uint64_t distance_too_high_w, uint64_t unsafe_interval,
+                       uint64_t rest, uint64_t ten_kappa, uint64_t unit) {
+  uint64_t small_distance = distance_too_high_w - unit;
+  uint64_t big_distance = distance_too_high_w + unit;
+  while (rest < small_distance &&
+         unsafe_interval - rest >= ten_kappa &&
+         (rest + ten_kappa < small_distance ||
+          small_distance - rest >= rest + ten_kappa - small_distance)) {
+    buffer[length - 1]--;
+    rest += ten_kappa;
+  }
+  if (rest < big_distance &&
+      unsafe_interval - rest >= ten_kappa &&
+      (rest + ten_kappa < big_distance ||
+       big_distance - rest > rest + ten_kappa - big_distance)) {
+    return false;
+  }
+  return (2 * unit <= rest) && (rest <= unsafe_interval - 4 * unit);
+}
+
+static bool digit_gen(diy_fp low, diy_fp w, diy_fp high, char *buffer, int &length, int &kappa) {
+  uint64_t unit = 1;
+  diy_fp too_low = {low.f - unit, low.e};
+  diy_fp too_high = {high.f + unit, high.e};
+  uint64_t unsafe_interval = too_high.f - too_low.f;
+  int one_shift = -w.e;
+  uint64_t one = (uint64_t)1 << one_shift;
+  uint32_t integrals = (uint32_t)(too_high.f >> one_shift);
+  uint64_t fractionals = too_high.f & (one - 1);
+  uint32_t divisor = 1;
+  kappa = 0;
+  if (integrals) {
+    kappa = 1;
+    while (integrals / divisor >= 10) {
+      divisor *= 10;
+      ++kappa;
+    }
+  }
+  length = 0;
+  while (kappa > 0) {
+    buffer[length++] = '0' + integrals / divisor;
+    integrals %= divisor;
+    --kappa;
+    uint64_t rest = ((uint64_t)integrals << one_shift) + fractionals;
+    if (rest < unsafe_interval) {
+      return round_weed(buffer, length, too_high.f - w.f, unsafe_interval, rest,
+                        (uint64_t)divisor << one_shift, unit);
+    }
+    divisor /= 10;
+  }
+  while (true) {
+    fractionals *= 10;
+    unit *= 10;
+    unsafe_interval *= 10;
+    buffer[length++] = '0' + (int)(fractionals >> one_shift);
+    fractionals &= one - 1;
+    --kappa;
+    if (fractionals < unsafe_interval) {
+      return round_weed(buffer, length, (too_high.f - w.f) * unit, unsafe_interval, fractionals, one, unit);
+    }
+  }
+}
+
+/*! Shortest digits of the positive finite value significand*2^exponent
+    whose format has significand_size bits, lowest_exponent is the
+    exponent of the denormals.  On success buffer holds length digits
+    and the value is buffer*10^decimal_exponent */
+static bool grisu3(uint64_t significand, int exponent, int significand_size, int lowest_exponent,
+                   char *buffer, int &length, int &decimal_exponent) {
+  diy_fp v = {significand, exponent};
+  diy_fp w = diy_fp_normalize(v);
+  diy_fp m_plus = diy_fp_normalize(diy_fp{(v.f << 1) + 1, v.e - 1});
+  diy_fp m_minus;
+  // At a power of two the next lower float is half as far away
+  if (v.f == ((uint64_t)1 << (significand_size - 1)) && v.e != lowest_exponent) {
+    m_minus = diy_fp{(v.f << 2) - 1, v.e - 2};
+  } else {
+    m_minus = diy_fp{(v.f << 1) - 1, v.e - 1};
+  }
+  m_minus.f <<= m_minus.e - m_plus.e;
+  m_minus.e = m_plus.e;
+  diy_fp ten_mk;
+  int mk;
+  cached_power_for_binary_exponent(GRISU_MIN_TARGET_EXPONENT - (w.e + 64), ten_mk, mk);
+  diy_fp scaled_w = diy_fp_multiply(w, ten_mk);
+  diy_fp scaled_minus = diy_fp_multiply(m_minus, ten_mk);
+  diy_fp scaled_plus = diy_fp_multiply(m_plus, ten_mk);
+  int kappa;
+  bool ok = digit_gen(scaled_minus, scaled_w, scaled_plus, buffer, length, kappa);
+  decimal_exponent = -mk + kappa;
+  return ok;
+}
+
+/*! Shortest digits of a nonzero finite single or double float, returns
+    false if the bignum algorithm is needed */
+static bool fast_float_to_digits(Float_sp number, char *buffer, int &length, int &decimal_exponent) {
+  if (number.single_floatp()) {
+    float f = std::fabs(number.unsafe_single_float());
+    if (f == 0.0f || !std::isfinite(f)) return false;
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    uint32_t biased = bits >> 23;
+    uint64_t significand = bits & 0x7fffff;
+    if (biased == 0) return grisu3(significand, -149, 24, -149, buffer, length, decimal_exponent);
+    return grisu3(significand | 0x800000, (int)biased - 150, 24, -149, buffer, length, decimal_exponent);
+  } else if (DoubleFloat_sp df = number.asOrNull<DoubleFloat_O>()) {
+    double d = std::fabs(df->get());
+    if (d == 0.0 || !std::isfinite(d)) return false;
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    uint64_t biased = bits >> 52;
+    uint64_t significand = bits & 0xfffffffffffffULL;
+    if (biased == 0) return grisu3(significand, -1074, 53, -1074, buffer, length, decimal_exponent);
+    return grisu3(significand | 0x10000000000000ULL, (int)biased - 1075, 53, -1074, buffer, length, decimal_exponent);
+  }
+  return false;
+}
+
 CL_LAMBDA(digits number position relativep);
 CL_DECLARE();
 CL_DOCSTRING("float_to_digits");
 CL_DEFUN T_mv core__float_to_digits(T_sp tdigits, Float_sp number, T_sp position, T_sp relativep) {
   ASSERT(tdigits.nilp()||gc::IsA<Str8Ns_sp>(tdigits));
   gctools::Fixnum k;
-  float_approx approx[1];
-  setup(number, approx);
-  change_precision(approx, position, relativep);
-  k = scale(approx);
   StrNs_sp digits;
   if (tdigits.nilp()) {
     digits = gc::As<StrNs_sp>(core__make_vector(cl::_sym_base_char,
@@ -246,6 +504,21 @@ CL_DEFUN T_mv core__float_to_digits(T_sp tdigits, Float_sp number, T_sp position
   } else {
     digits = gc::As<StrNs_sp>(tdigits);
   }
+  if (position.nilp()) {
+    // Free format output only needs the shortest digits
+    char buffer[20];
+    int length, decimal_exponent;
+    if (fast_float_to_digits(number, buffer, length, decimal_exponent)) {
+      for (int i = 0; i < length; ++i) {
+        digits->vectorPushExtend(clasp_make_character(buffer[i]));
+      }
+      return Values(clasp_make_fixnum(decimal_exponent + length), digits);
+    }
+  }
+  float_approx approx[1];
+  setup(number, approx);
+  change_precision(approx, position, relativep);
+  k = scale(approx);
   generate(digits, approx);
   return Values(clasp_make_fixnum(k), digits);
 }
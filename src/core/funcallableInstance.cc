@@ -209,7 +209,7 @@ T_sp FuncallableInstance_O::copyInstance() const {
   copy->_Class = cl;
   copy->_Rack = this->_Rack;
   copy->_Sig = this->_Sig;
-  copy->_isgf = this->_isgf;
+  copy->_isgf = this->_isgf.load();
   return copy;
 }
 
@@ -218,14 +218,14 @@ T_sp FuncallableInstance_O::setFuncallableInstanceFunction(T_sp functionOrT) {
   SYMBOL_SC_(ClosPkg, standardOptimizedReaderFunction);
   SYMBOL_SC_(ClosPkg, standardOptimizedWriterFunction);
   if (functionOrT == clos::_sym_invalidated_dispatch_function) {
-    this->_isgf = CLASP_INVALIDATED_DISPATCH;
+    this->_isgf.store(CLASP_INVALIDATED_DISPATCH, std::memory_order_release);
     // FIXME Jump straight to the invalidated-dispatch-function
     this->entry.store(this->invalidated_entry_point);
   } else if (functionOrT.nilp()) {
-    this->_isgf = CLASP_NOT_FUNCALLABLE;
+    this->_isgf.store(CLASP_NOT_FUNCALLABLE, std::memory_order_release);
     this->entry.store(this->not_funcallable_entry_point);
   } else if (gc::IsA<Function_sp>(functionOrT)) {
-    this->_isgf = CLASP_NORMAL_DISPATCH;
+    this->_isgf.store(CLASP_NORMAL_DISPATCH, std::memory_order_release);
     this->GFUN_DISPATCHER_set(functionOrT);
     this->entry.store(gc::As_unsafe<Function_sp>(functionOrT)->entry.load());
   } else {
@@ -239,7 +239,7 @@ T_sp FuncallableInstance_O::setFuncallableInstanceFunction(T_sp functionOrT) {
 void FuncallableInstance_O::describe(T_sp stream) {
   stringstream ss;
   ss << (BF("FuncallableInstance\n")).str();
-  ss << (BF("isgf %d\n") % this->_isgf).str();
+  ss << (BF("isgf %d\n") % this->_isgf.load()).str();
   ss << (BF("_Class: %s\n") % _rep_(this->_Class).c_str()).str();
   for (int i(1); i < this->_Rack->length(); ++i) {
     ss << (BF("_Rack[%d]: %s\n") % i % _rep_((*this->_Rack)[i]).c_str()).str();
@@ -257,7 +257,7 @@ CL_DEFUN bool core__get_funcallable_instance_debug_on(FuncallableInstance_sp ins
 
 CL_DEFUN T_mv clos__getFuncallableInstanceFunction(T_sp obj) {
   if (FuncallableInstance_sp iobj = obj.asOrNull<FuncallableInstance_O>()) {
-    switch (iobj->_isgf) {
+    switch (iobj->_isgf.load(std::memory_order_acquire)) {
     case CLASP_NORMAL_DISPATCH:
         return Values(_lisp->_true(),Pointer_O::create((void*)iobj->entry.load()));
     case CLASP_INVALIDATED_DISPATCH:
@@ -265,7 +265,7 @@ CL_DEFUN T_mv clos__getFuncallableInstanceFunction(T_sp obj) {
     case CLASP_NOT_FUNCALLABLE:
         return Values(clos::_sym_not_funcallable);
     }
-    return Values(clasp_make_fixnum(iobj->_isgf),_Nil<T_O>());
+    return Values(clasp_make_fixnum(iobj->_isgf.load()),_Nil<T_O>());
   }
   return Values(_Nil<T_O>(),_Nil<T_O>());
 };
@@ -298,6 +298,42 @@ T_sp FuncallableInstance_O::GFUN_SPECIALIZER_PROFILE_compare_exchange(T_sp expec
   return exchanged ? new_value : expected;
 }
 
+/*! Install DISPATCHER in place of the invalidated dispatch function, but only
+    if the call history is still the one DISPATCHER was compiled from.
+    The dispatcher and _isgf are written before the entry point is published so
+    anyone who sees the new entry point also sees them, and are put back if
+    the entry point was not the invalidated one.
+    If the call history changes right after installation the generic function is
+    invalidated again, so a stale dispatcher never survives a call history change. */
+bool FuncallableInstance_O::GFUN_DISPATCHER_compare_exchange(T_sp call_history, Function_sp dispatcher) {
+  claspFunction invalidated = this->invalidated_entry_point;
+  claspFunction dispatcher_entry = dispatcher->entry.load();
+  if (this->_CallHistory.load() != call_history) return false;
+  T_sp old_dispatcher = this->_CompiledDispatchFunction.load();
+  int old_isgf = this->_isgf.load(std::memory_order_acquire);
+  this->GFUN_DISPATCHER_set(dispatcher);
+  this->_isgf.store(CLASP_NORMAL_DISPATCH, std::memory_order_release);
+  if (!this->entry.compare_exchange_strong(invalidated,dispatcher_entry)) {
+    // Only undo our own writes - whoever changed the entry point may have set them too
+    this->_CompiledDispatchFunction.compare_exchange_strong(dispatcher,old_dispatcher);
+    int normal = CLASP_NORMAL_DISPATCH;
+    this->_isgf.compare_exchange_strong(normal,old_isgf,std::memory_order_acq_rel);
+    return false;
+  }
+  if (this->_CallHistory.load() != call_history) {
+    if (this->entry.compare_exchange_strong(dispatcher_entry,this->invalidated_entry_point)) {
+      this->_isgf.store(CLASP_INVALIDATED_DISPATCH, std::memory_order_release);
+    }
+    return false;
+  }
+  return true;
+}
+
+T_sp FuncallableInstance_O::GFUN_INTERPRETED_DISPATCHER_compare_exchange(T_sp expected, T_sp new_value) {
+  bool exchanged = this->_InterpretedDispatcher.compare_exchange_strong(expected,new_value);
+  return exchanged ? new_value : expected;
+}
+
 CL_DEFUN T_sp clos__generic_function_specializer_profile(FuncallableInstance_sp gf) {
   return gf->GFUN_SPECIALIZER_PROFILE();
 }
@@ -314,6 +350,19 @@ CL_DEFUN T_sp clos__generic_function_call_history_compare_exchange(FuncallableIn
   return gf->GFUN_CALL_HISTORY_compare_exchange(expected,new_value);
 }
 
+CL_DOCSTRING("Install the compiled DISPATCHER if GF is invalidated and its call history is still CALL-HISTORY. Return T if it was installed.");
+CL_DEFUN bool clos__generic_function_dispatcher_compare_exchange(FuncallableInstance_sp gf, T_sp call_history, Function_sp dispatcher) {
+  return gf->GFUN_DISPATCHER_compare_exchange(call_history,dispatcher);
+}
+
+CL_DEFUN T_sp clos__generic_function_interpreted_dispatcher(FuncallableInstance_sp gf) {
+  return gf->GFUN_INTERPRETED_DISPATCHER();
+}
+
+CL_DEFUN T_sp clos__generic_function_interpreted_dispatcher_compare_exchange(FuncallableInstance_sp gf, T_sp expected, T_sp new_value) {
+  return gf->GFUN_INTERPRETED_DISPATCHER_compare_exchange(expected,new_value);
+}
+
 CL_DEFUN T_sp clos__generic_function_compiled_dispatch_function(T_sp obj) {
   return gc::As<FuncallableInstance_sp>(obj)->GFUN_DISPATCHER();
 }
@@ -52,20 +52,8 @@ namespace core {
 
 
 
+// Readers never lock - see the comment on HashTable_O in hashTable.h
 #ifdef CLASP_THREADS
-  struct HashTableReadLock {
-    const HashTable_O* _hashTable;
-  HashTableReadLock(const HashTable_O* ht) : _hashTable(ht) {
-    if (this->_hashTable->_Mutex) {
-      this->_hashTable->_Mutex->shared_lock();
-    }
-  }
-    ~HashTableReadLock() {
-      if (this->_hashTable->_Mutex) {
-        this->_hashTable->_Mutex->shared_unlock();
-      }
-    }
-  };
   struct HashTableWriteLock {
     const HashTable_O* _hashTable;
   HashTableWriteLock(const HashTable_O* ht) : _hashTable(ht) {
@@ -82,10 +70,8 @@ namespace core {
 #endif
 
 #ifdef CLASP_THREADS
-#define HT_READ_LOCK(me) HashTableReadLock _zzz(me)
 #define HT_WRITE_LOCK(me) HashTableWriteLock _zzz(me)
 #else
-#define HT_READ_LOCK(me) 
 #define HT_WRITE_LOCK(me) 
 #endif
 
@@ -128,10 +114,10 @@ void HashTable_O::set_thread_safe(bool thread_safe)
 #endif
 }
 
-CL_LAMBDA(&key (test (function eql)) (size 64) (rehash-size 2.0) (rehash-threshold 1.0) weakness debug thread-safe);
+CL_LAMBDA(&key (test (function eql)) (size 64) (rehash-size 2.0) (rehash-threshold 1.0) weakness debug thread-safe concurrency);
 CL_DECLARE();
-CL_DOCSTRING("see CLHS");
-CL_DEFUN T_sp cl__make_hash_table(T_sp test, Fixnum_sp size, Number_sp rehash_size, Real_sp orehash_threshold, Symbol_sp weakness, T_sp debug, T_sp thread_safe) {
+CL_DOCSTRING("see CLHS - :thread-safe t makes writers lock the table, :concurrency n splits it into n independently locked shards");
+CL_DEFUN T_sp cl__make_hash_table(T_sp test, Fixnum_sp size, Number_sp rehash_size, Real_sp orehash_threshold, Symbol_sp weakness, T_sp debug, T_sp thread_safe, T_sp concurrency) {
   SYMBOL_EXPORT_SC_(KeywordPkg, key);
   if (weakness.notnilp()) {
     if (weakness == INTERN_(kw, key)) {
@@ -159,6 +145,26 @@ CL_DEFUN T_sp cl__make_hash_table(T_sp test, Fixnum_sp size, Number_sp rehash_si
     table->_Mutex = mp::SharedMutex_O::make_shared_mutex(_Nil<T_O>());
   }
 #endif
+  if (concurrency.notnilp()) {
+    Fixnum shards = clasp_to_fixnum(concurrency);
+    if (shards < 1) {
+      SIMPLE_ERROR(BF(":concurrency must be a positive integer - it was %s") % _rep_(concurrency));
+    }
+#if defined(CLASP_THREADS) && !defined(USE_MPS)
+    // With MPS a moved key hashes to a different shard than the one holding it,
+    // so there a sharded table is just a thread-safe one
+    if (shards > 1) {
+      SimpleVector_sp vshards = SimpleVector_O::make(shards);
+      for (Fixnum i = 0; i < shards; ++i) {
+        (*vshards)[i] = cl__make_hash_table(test, make_fixnum(isize / shards + 1), rehash_size, orehash_threshold,
+                                            _Nil<Symbol_O>(), _Nil<T_O>(), _lisp->_true());
+      }
+      table->_Shards = vshards;
+      return table;
+    }
+#endif
+    table->set_thread_safe(true);
+  }
   return table;
 }
 
@@ -191,17 +197,17 @@ CL_DEFUN T_mv cl__maphash(T_sp function_desig, T_sp thash_table) {
     SIMPLE_ERROR(BF("maphash called with nil hash-table"));
   }
   HashTable_sp hash_table = gc::As<HashTable_sp>(thash_table);
-  HT_READ_LOCK(&*hash_table);
-  VectorObjects_sp table = hash_table->_HashTable;
-  for (size_t it = 0, itEnd = cl__length(table); it < itEnd; ++it) {
-    List_sp first = (*table)[it];
-    for (auto cur : first) {
-      List_sp entry = oCar(cur);
-      T_sp key = oCar(entry);
-      T_sp value = oCdr(entry);
-      if (!value.unboundp()) {
-        eval::funcall(func, key, value);
-      }
+  if (hash_table->shardedp()) {
+    for (size_t is = 0, isEnd = hash_table->_Shards->length(); is < isEnd; ++is) {
+      cl__maphash(func, hash_table->shard(is));
+    }
+    return (Values(_Nil<T_O>()));
+  }
+  SimpleVector_sp table = hash_table->loadTable();
+  T_sp key, value;
+  for (size_t it = 0, itEnd = table->length() / HashTable_O::EntryStride; it < itEnd; ++it) {
+    if (HashTable_O::readEntry(*table, it, key, value)) {
+      eval::funcall(func, key, value);
     }
   }
   //        printf("%s:%d finished maphash on hash-table@%p\n", __FILE__, __LINE__, hash_table.raw_());
@@ -216,13 +222,36 @@ CL_DEFUN T_sp cl__clrhash(HashTable_sp hash_table) {
   return hash_table;
 };
 
-CL_LAMBDA(cons);
+CL_LAMBDA(hash-table index);
 CL_DECLARE();
-CL_DOCSTRING("hashTableEntryDeletedP");
-CL_DEFUN bool core__hash_table_entry_deleted_p(T_sp cons) {
-  if (!cons.consp())
-    SIMPLE_ERROR(BF("Arg must be a cons"));
-  return oCdr(gc::As<Cons_sp>(cons)).unboundp();
+CL_DOCSTRING("Return (values next-index key value) for the first entry of hash-table at or after entry index, or NIL if there are no more entries");
+CL_DEFUN T_mv core__hash_table_next_entry(HashTable_sp hash_table, Fixnum index) {
+  if (hash_table->shardedp()) {
+    // Interleave the shards: index i is entry i/nshards of shard i%nshards
+    size_t nshards = hash_table->_Shards->length();
+    size_t maxCapacity = 0;
+    for (size_t is = 0; is < nshards; ++is) {
+      size_t capacity = hash_table->shard(is)->loadTable()->length() / HashTable_O::EntryStride;
+      if (capacity > maxCapacity) maxCapacity = capacity;
+    }
+    T_sp key, value;
+    for (size_t it(index < 0 ? 0 : index), itEnd(maxCapacity * nshards); it < itEnd; ++it) {
+      SimpleVector_sp table = hash_table->shard(it % nshards)->loadTable();
+      size_t entry = it / nshards;
+      if (entry < table->length() / HashTable_O::EntryStride && HashTable_O::readEntry(*table, entry, key, value)) {
+        return Values(make_fixnum(it + 1), key, value);
+      }
+    }
+    return Values(_Nil<T_O>());
+  }
+  SimpleVector_sp table = hash_table->loadTable();
+  T_sp key, value;
+  for (size_t it(index < 0 ? 0 : index), itEnd(table->length() / HashTable_O::EntryStride); it < itEnd; ++it) {
+    if (HashTable_O::readEntry(*table, it, key, value)) {
+      return Values(make_fixnum(it + 1), key, value);
+    }
+  }
+  return Values(_Nil<T_O>());
 };
 
 CL_LAMBDA(&rest args);
@@ -272,18 +301,31 @@ CL_DEFUN bool cl__remhash(T_sp key, HashTable_sp ht) {
 
 void HashTable_O::clrhash() {
   ASSERT(!clasp_zerop(this->_RehashSize));
+  if (this->shardedp()) {
+    for (size_t is = 0, isEnd = this->_Shards->length(); is < isEnd; ++is) {
+      this->shard(is)->clrhash();
+    }
+    return;
+  }
   this->setup(4, this->_RehashSize, this->_RehashThreshold);
 }
 
 void HashTable_O::setup(uint sz, Number_sp rehashSize, double rehashThreshold) {
   HT_WRITE_LOCK(this);
-  sz = this->resizeEmptyTable_no_lock(sz);
   this->_RehashSize = rehashSize;
   ASSERT(!clasp_zerop(this->_RehashSize));
   this->_RehashThreshold = rehashThreshold;
+  // Size the table so that sz entries fit without growing
+  sz = this->resizeEmptyTable_no_lock(sz / this->maxLoadFactor() + 1);
   this->_HashTableCount = 0;
 }
 
+double HashTable_O::maxLoadFactor() const {
+  double threshold = this->_RehashThreshold;
+  if (threshold <= 0.0 || threshold > MaxLoadFactor) return MaxLoadFactor;
+  return threshold;
+}
+
 void HashTable_O::sxhash_eq(HashGenerator &hg, T_sp obj, LocationDependencyPtrT ld) {
   volatile void* address = obj.raw_();
 #ifdef USE_MPS
@@ -452,7 +494,6 @@ bool HashTable_O::equalp(T_sp other) const {
 }
 
 List_sp HashTable_O::keysAsCons() {
-  HT_READ_LOCK(this);
   List_sp res = _Nil<T_O>();
   this->mapHash([&res](T_sp key, T_sp val) {
       res = Cons_O::create(key,res);
@@ -492,34 +533,50 @@ void HashTable_O::fields(Record_sp node) {
   }
 }
 
+SimpleVector_sp HashTable_O::makeEmptyTable(size_t sz) {
+  // The capacity must be a power of two so that hashes can be masked
+  size_t capacity = 16;
+  while (capacity < sz) capacity <<= 1;
+  // Every slot starts out unbound - that marks the entry as empty
+  return SimpleVector_O::make(capacity * EntryStride, _Unbound<T_O>());
+}
+
 uint HashTable_O::resizeEmptyTable_no_lock(size_t sz) {
-  if (sz < 16) sz = 16;
-  this->_HashTable = VectorObjects_O::make(sz, _Nil<T_O>() );
+  SimpleVector_sp table = makeEmptyTable(sz);
+  size_t capacity = table->length() / EntryStride;
+  this->storeTable(table);
+  this->_HashTableDeleted = 0;
   (void) ENSURE_VALID_OBJECT(this->_HashTable);
 #ifdef USE_MPS
   mps_ld_reset(const_cast<mps_ld_t>(&(this->_LocationDependency)), global_arena);
 #endif
-  return sz;
+  return capacity;
 }
 
 CL_LAMBDA(arg);
 CL_DECLARE();
 CL_DOCSTRING("hash-table-count");
 CL_DEFUN uint cl__hash_table_count(HashTable_sp ht) {
-  HT_READ_LOCK(&*ht);
-  return ht->_HashTableCount;
+  return ht->hashTableCount();
 }
 
 uint HashTable_O::hashTableCount() const {
-  HT_READ_LOCK(this);
+  if (this->shardedp()) {
+    uint count = 0;
+    for (size_t is = 0, isEnd = this->_Shards->length(); is < isEnd; ++is) {
+      count += this->shard(is)->_HashTableCount;
+    }
+    return count;
+  }
   return this->_HashTableCount;
 }
 
 uint HashTable_O::calculateHashTableCount() const {
-  HT_READ_LOCK(this);
   uint cnt = 0;
-  for (size_t it(0), itEnd(cl__length(ENSURE_VALID_OBJECT(this->_HashTable))); it < itEnd; ++it) {
-    cnt += cl__length((ENSURE_VALID_OBJECT(this->_HashTable)->operator[](it)));
+  SimpleVector_sp table = ENSURE_VALID_OBJECT(this->loadTable());
+  T_sp key, value;
+  for (size_t it(0), itEnd(table->length() / EntryStride); it < itEnd; ++it) {
+    if (readEntry(*table, it, key, value)) ++cnt;
   }
   return cnt;
 }
@@ -528,8 +585,7 @@ CL_LAMBDA(arg);
 CL_DECLARE();
 CL_DOCSTRING("hash-table-size");
 CL_DEFUN uint cl__hash_table_size(HashTable_sp ht) {
-  HT_READ_LOCK(&*ht);
-  return cl__length(ENSURE_VALID_OBJECT(ht->_HashTable));
+  return ht->hashTableNumberOfHashes();
 }
 
 bool HashTable_O::keyTest(T_sp entryKey, T_sp searchKey) const {
@@ -540,14 +596,28 @@ gc::Fixnum HashTable_O::sxhashKey(T_sp obj, gc::Fixnum bound, bool willAddKey) c
   SUBCLASS_MUST_IMPLEMENT();
 }
 
-List_sp HashTable_O::findAssoc_no_lock(gc::Fixnum index, T_sp key) const {
-  LOG(BF("findAssoc at index %d\n") %index);
-  for (auto cur : gc::As_unsafe<List_sp>((*ENSURE_VALID_OBJECT(this->_HashTable))[index])) {
-    List_sp pair = CONS_CAR(cur);
-    ASSERT(pair.consp());
-    if (this->keyTest(CONS_CAR(pair), key)) return pair;
+gc::Fixnum HashTable_O::findEntry(SimpleVector_O &table, T_sp key, gc::Fixnum hash, T_sp &value) const {
+  return probe(table, key, hash, [this](T_sp entryKey, T_sp searchKey) { return this->keyTest(entryKey, searchKey); }, value);
+}
+
+size_t HashTable_O::insertEntry_no_lock(SimpleVector_O &table, gc::Fixnum hash, T_sp key, T_sp value) {
+  // The caller has made sure that key is not in the table and that
+  // there is at least one free entry so this always terminates
+  size_t mask = table.length() / EntryStride - 1;
+  size_t index = hash & mask;
+  while (true) {
+    T_sp *entry = &table[index * EntryStride];
+    T_sp probeKey = entry[KeyOffset];
+    if (probeKey.unboundp() || probeKey.deletedp()) {
+      if (probeKey.deletedp()) --(this->_HashTableDeleted);
+      // Readers may be looking at this entry, storing the key last publishes it
+      entry[HashOffset] = make_fixnum(hash);
+      entry[ValueOffset] = value;
+      storeSlot(entry[KeyOffset], key);
+      return index;
+    }
+    index = (index + 1) & mask;
   }
-  return _Nil<T_O>();
 }
 
 CL_LAMBDA(key hash-table &optional default-value);
@@ -563,16 +633,11 @@ CL_DEFUN T_mv core__gethash3(T_sp key, T_sp hashTable, T_sp default_value) {
   return ht->gethash(key, default_value);
 };
 
-List_sp HashTable_O::tableRef_no_lock(T_sp key) {
-    ASSERT(gc::IsA<Array_sp>(this->_HashTable));
-    cl_index length = ENSURE_VALID_OBJECT(this->_HashTable)->length();
-    cl_index index = this->safe_sxhashKey(key, length, false);
-    List_sp pair = _Nil<T_O>();
-    for (auto cur : gc::As_unsafe<List_sp>((*ENSURE_VALID_OBJECT(this->_HashTable))[index])) {
-      pair = CONS_CAR(cur);
-      ASSERT(pair.consp());
-      if (this->keyTest(CONS_CAR(pair), key)) return pair;
-    }
+gc::Fixnum HashTable_O::tableRef_no_lock(T_sp key, gc::Fixnum &hash, bool willAddKey) {
+    hash = this->entryHash(key, willAddKey);
+    T_sp value;
+    gc::Fixnum index = this->findEntry(*this->_HashTable, key, hash, value);
+    if (index >= 0) return index;
 #if defined(USE_MPS)
   // Location dependency test if key is stale
     if (key.objectp()) {
@@ -582,172 +647,203 @@ List_sp HashTable_O::tableRef_no_lock(T_sp key) {
       }
     }
 #endif
-    return _Nil<T_O>();
+    return -1;
   }
 
   CL_LAMBDA(ht);
   CL_DECLARE();
   CL_DOCSTRING("hashTableForceRehash");
   CL_DEFUN void core__hash_table_force_rehash(HashTable_sp ht) {
+    if (ht->shardedp()) {
+      for (size_t is = 0, isEnd = ht->_Shards->length(); is < isEnd; ++is) {
+        core__hash_table_force_rehash(ht->shard(is));
+      }
+      return;
+    }
     ht->rehash(false, _Unbound<T_O>());
   }
 
+  bool HashTable_O::lookup(T_sp key, T_sp &value) {
+    if (this->shardedp()) return this->shardFor(key)->lookup(key, value);
+    gc::Fixnum hash = this->entryHash(key, false);
+    while (true) {
+      SimpleVector_sp table = this->loadTable();
+      if (this->findEntry(*table, key, hash, value) >= 0) return true;
+      // A writer may have rehashed into a new table while we probed the old one
+      if (this->loadTable().raw_() == table.raw_()) break;
+    }
+#if defined(USE_MPS)
+    // Rehashing after the collector moved the key is a write - take the lock
+    if (key.objectp()) {
+      void *blockAddr = &(*key);
+      if (mps_ld_isstale(const_cast<mps_ld_t>(&(this->_LocationDependency)), global_arena, blockAddr)) {
+        HT_WRITE_LOCK(this);
+        gc::Fixnum index = this->tableRef_no_lock(key);
+        if (index >= 0) {
+          value = this->entryValue(index);
+          return true;
+        }
+      }
+    }
+#endif
+    return false;
+  }
+
   T_mv HashTable_O::gethash(T_sp key, T_sp default_value) {
     LOG(BF("gethash looking for key[%s]") % _rep_(key));
-    HT_READ_LOCK(this);
-    List_sp keyValuePair = this->tableRef_no_lock(key);
-    LOG(BF("Found keyValueCons")); // % keyValueCons->__repr__() ); INFINITE-LOOP
-    if (keyValuePair.consp()) {
-      T_sp value = CONS_CDR(keyValuePair);
-      if (value.unboundp()) {
-        LOG(BF("valueOrUnbound is unbound - returning default"));
-        return (Values(default_value, _Nil<T_O>()));
-      }
-      LOG(BF("Found assoc - returning")); // : %s") % res->__repr__() );  INFINITE-LOOP
+    T_sp value;
+    if (this->lookup(key, value)) {
+      LOG(BF("Found entry - returning"));
       return Values(value, _lisp->_true());
-    }      
+    }
     return Values(default_value, _Nil<T_O>());
   }
 
   CL_LISPIFY_NAME("core:hashIndex");
   CL_DEFMETHOD gc::Fixnum HashTable_O::hashIndex(T_sp key) const {
-    gc::Fixnum idx = this->safe_sxhashKey(key, ENSURE_VALID_OBJECT(this->_HashTable)->length(), false);
+    gc::Fixnum idx = this->entryHash(key, false) & (this->tableCapacity() - 1);
     return idx;
   }
 
   List_sp HashTable_O::find(T_sp key) {
-    HT_READ_LOCK(this);
-    List_sp keyValue = this->tableRef_no_lock(key);
-    if (!keyValue.consp()) return keyValue;
-    if (CONS_CDR(keyValue).unboundp()) return _Nil<T_O>();
-    return keyValue;
+    T_sp value;
+    if (!this->lookup(key, value)) return _Nil<T_O>();
+    return Cons_O::create(key, value);
   }
 
   bool HashTable_O::contains(T_sp key) {
-    HT_READ_LOCK(this);
-    List_sp keyValue = this->find(key);
-    return keyValue.consp();
+    T_sp value;
+    return this->lookup(key, value);
   }
 
   bool HashTable_O::remhash(T_sp key) {
+    if (this->shardedp()) return this->shardFor(key)->remhash(key);
     HT_WRITE_LOCK(this);
-    List_sp keyValuePair = this->tableRef_no_lock(key);
-    if (keyValuePair.consp() && !CONS_CDR(keyValuePair).unboundp()) {
-      CONS_CDR(keyValuePair) = _Unbound<T_O>();
-      this->_HashTableCount--;
-      return true;
+    gc::Fixnum index = this->tableRef_no_lock(key);
+    if (index < 0) return false;
+    storeSlot(this->entryKey(index), _Deleted<T_O>());
+    storeSlot(this->entryValue(index), _Unbound<T_O>());
+    ++(this->_HashTableDeleted);
+    this->_HashTableCount--;
+    // No probe continues past an empty entry, so if the next entry is empty
+    // this tombstone and the ones directly before it can be emptied as well
+    size_t mask = this->tableCapacity() - 1;
+    size_t cur = index;
+    while (this->entryKey(cur).deletedp() && this->entryKey((cur + 1) & mask).unboundp()) {
+      storeSlot(this->entryKey(cur), _Unbound<T_O>());
+      --(this->_HashTableDeleted);
+      cur = (cur - 1) & mask;
     }
-    return false;
+    return true;
   }
 
   CL_LISPIFY_NAME("core:hashTableSetfGethash");
   CL_DEFMETHOD T_sp HashTable_O::hash_table_setf_gethash(T_sp key, T_sp value) {
     LOG(BF("About to hash_table_setf_gethash for %s@%p -> %s@%p\n") % _rep_(key) % (void*)&(*key) % _rep_(value) % (void*)&(*value));
+    if (this->shardedp()) return this->shardFor(key)->hash_table_setf_gethash(key, value);
     HT_WRITE_LOCK(this);
-    List_sp keyValuePair = this->tableRef_no_lock(key);
-    {
-      if (keyValuePair.nilp()) {
-        gc::Fixnum index = this->safe_sxhashKey(key, cl__length(ENSURE_VALID_OBJECT(this->_HashTable)), true /*Will add key*/);
-        Cons_sp newKeyValue = Cons_O::create(key, value);
-    //            printf("%s:%d  Inserted newKeyValue@%p\n", __FILE__, __LINE__, newKeyValue.raw_());
-        Cons_sp newEntry = Cons_O::create(newKeyValue, ENSURE_VALID_OBJECT(this->_HashTable)->operator[](index));
-        ENSURE_VALID_OBJECT(this->_HashTable)->operator[](index) = newEntry;
-    //            this->_HashTableEntryCount++;
-        ++(this->_HashTableCount);
-      } else if (oCdr(keyValuePair).unboundp()) {
-        keyValuePair.asCons()->setCdr(value);
-        ++(this->_HashTableCount);
-      } else {
-        keyValuePair.asCons()->setCdr(value);
-      }
-      if (this->_HashTableCount > this->_RehashThreshold * cl__length(ENSURE_VALID_OBJECT(this->_HashTable))) {
-        LOG(BF("Expanding hash table"));
-        this->rehash_no_lock(true, _Unbound<T_O>());
-      }
+    gc::Fixnum hash;
+    gc::Fixnum index = this->tableRef_no_lock(key, hash, true /*Will add key*/);
+    if (index >= 0) {
+      storeSlot(this->entryValue(index), value);
+      return value;
+    }
+    double limit = this->maxLoadFactor() * this->tableCapacity();
+    if (this->_HashTableCount + this->_HashTableDeleted + 1 > limit) {
+      // Grow if the live entries are crowding the table, otherwise it is
+      // tombstones that are - rebuilding at the same size sweeps them out
+      LOG(BF("Expanding hash table"));
+      this->rehash_no_lock(this->_HashTableCount + 1 > limit / 2, _Unbound<T_O>());
+#ifdef USE_MPS
+      // The rehash reset the location dependency, register key again
+      hash = this->entryHash(key, true);
+#endif
     }
+    this->insertEntry_no_lock(*this->_HashTable, hash, key, value);
+    ++(this->_HashTableCount);
     return value;
   }
 
-  List_sp HashTable_O::rehash_no_lock(bool expandTable, T_sp findKey) {
+  gc::Fixnum HashTable_O::rehash_no_lock(bool expandTable, T_sp findKey) {
   //        printf("%s:%d rehash of hash-table@%p\n", __FILE__, __LINE__,  this );
     ASSERTF(!clasp_zerop(this->_RehashSize), BF("RehashSize is zero - it shouldn't be"));
-    ASSERTF(cl__length(ENSURE_VALID_OBJECT(this->_HashTable)) != 0, BF("HashTable is empty in expandHashTable - this shouldn't be"));
+    ASSERTF(this->tableCapacity() != 0, BF("HashTable is empty in expandHashTable - this shouldn't be"));
 #ifdef DEBUG_REHASH_COUNT
     this->_RehashCount++;
 #endif
-    List_sp foundKeyValuePair(_Nil<T_O>());
-    LOG(BF("At start of expandHashTable current hash table size: %d") % cl__length(ENSURE_VALID_OBJECT(this->_HashTable)));
-    gc::Fixnum curSize = cl__length(ENSURE_VALID_OBJECT(this->_HashTable));
-    gc::Fixnum newSize = 0;
+    gc::Fixnum foundIndex = -1;
+    LOG(BF("At start of expandHashTable current hash table size: %d") % this->tableCapacity());
+    gc::Fixnum curSize = this->tableCapacity();
+    gc::Fixnum newSize = curSize;
     if (expandTable) {
       if (cl__integerp(this->_RehashSize)) {
         newSize = curSize + clasp_to_int(gc::As<Integer_sp>(this->_RehashSize));
       } else if (cl__floatp(this->_RehashSize)) {
         newSize = curSize * clasp_to_double(this->_RehashSize);
       }
-    } else {
-      newSize = curSize;
+      if (newSize <= curSize) newSize = curSize * 2;
     }
-    VectorObjects_sp oldTable = ENSURE_VALID_OBJECT(this->_HashTable);
-    newSize = this->resizeEmptyTable_no_lock(newSize);
+    SimpleVector_sp oldTable = ENSURE_VALID_OBJECT(this->_HashTable);
+    // Fill the new table privately and only then publish it to readers
+    SimpleVector_sp newTable = makeEmptyTable(newSize);
+    newSize = newTable->length() / EntryStride;
+#ifdef USE_MPS
+    mps_ld_reset(const_cast<mps_ld_t>(&(this->_LocationDependency)), global_arena);
+#endif
     LOG(BF("Resizing table to size: %d") % newSize);
-    size_t oldSize = cl__length(oldTable);
-    for (size_t it(0), itEnd(oldSize); it < itEnd; ++it) {
-      for (auto cur : coerce_to_list((*oldTable)[it])) {
-        List_sp pair = CONS_CAR(cur);
-        T_sp key = CONS_CAR(pair);
-        T_sp value = CONS_CDR(pair);
-        if (!value.unboundp()) {
-          // key/value represent a valid entry in the hash table
-          //
-          // If findKey is not unbound and we haven't already found
-          // the value that it points to.
-          // then while we are rehashing the hash table we are also looking
-          // for the key it points to.
-          // Check if the current key matches findKey and if it does
-          // set foundKeyValuePair so that it will be returned when
-          // the rehash is complete.
-          if (foundKeyValuePair.nilp() && !findKey.unboundp()) {
-            if (this->keyTest(key, findKey)) {
-              foundKeyValuePair = pair;
-            }
-          }
-          gc::Fixnum index = this->safe_sxhashKey(key, newSize, true /* Will add key */);
-          LOG(BF("Re-indexing key[%s] to index[%d]") % _rep_(key) % index);
-          Cons_sp newCur = Cons_O::create(pair, ENSURE_VALID_OBJECT(this->_HashTable)->operator[](index));
-          ENSURE_VALID_OBJECT(this->_HashTable)->operator[](index) = newCur;
-        }
+    for (size_t it(0), itEnd(oldTable->length()); it < itEnd; it += EntryStride) {
+      T_sp value = (*oldTable)[it + ValueOffset];
+      if (value.unboundp()) continue;
+      T_sp key = (*oldTable)[it + KeyOffset];
+#ifdef USE_MPS
+      // Address based hashes may have been invalidated by the collector,
+      // recompute them and register the keys with the new location dependency
+      gc::Fixnum hash = this->entryHash(key, true /* Will add key */);
+#else
+      gc::Fixnum hash = (*oldTable)[it + HashOffset].unsafe_fixnum();
+#endif
+      size_t index = this->insertEntry_no_lock(*newTable, hash, key, value);
+      LOG(BF("Re-indexing key[%s] to index[%d]") % _rep_(key) % index);
+      // If findKey is not unbound then while we are rehashing the
+      // hash table we are also looking for the entry it points to.
+      if (foundIndex < 0 && !findKey.unboundp() && this->keyTest(key, findKey)) {
+        foundIndex = index;
       }
     }
+    this->storeTable(newTable);
+    this->_HashTableDeleted = 0;
 #ifdef DEBUG_MONITOR
-    size_t max_alist_len = 0;
-    size_t count = 0;
+    size_t max_probe_len = 0;
+    size_t mask = newSize - 1;
     for (size_t _xxx(0); _xxx<newSize; ++_xxx) {
-      size_t this_len = cl__length((this->_HashTable)->operator[](_xxx));
-      count += this_len;
-      max_alist_len = (max_alist_len<this_len) ? this_len : max_alist_len;
+      if (this->entryValue(_xxx).unboundp()) continue;
+      size_t home = (*this->_HashTable)[_xxx * EntryStride + HashOffset].unsafe_fixnum() & mask;
+      size_t this_len = (_xxx - home) & mask;
+      max_probe_len = (max_probe_len<this_len) ? this_len : max_probe_len;
     }
-    MONITOR(BF("hash-table %p Resizing from %d to %d buckets - "
+    MONITOR(BF("hash-table %p Resizing from %d to %d entries - "
 #ifdef DEBUG_REHASH_COUNT
                "rehash-count: %d "
 #endif
-               "max-alist-length: %d hash-table-count: %d \n") % ((void*)this) % curSize % newSize
+               "max-probe-length: %d hash-table-count: %d \n") % ((void*)this) % curSize % newSize
 #ifdef DEBUG_REHASH_COUNT
             % this->_RehashCount
 #endif
-            % max_alist_len % count );
+            % max_probe_len % this->_HashTableCount );
 #endif
-    return foundKeyValuePair;
+    return foundIndex;
   }
 
-  List_sp HashTable_O::rehash(bool expandTable, T_sp findKey) {
+  gc::Fixnum HashTable_O::rehash(bool expandTable, T_sp findKey) {
     return this->rehash_no_lock(expandTable,findKey);
   }
 
   string HashTable_O::__repr__() const {
     stringstream ss;
-    ss << "#<" << this->_instanceClass()->_classNameAsString() << " :count " << this->_HashTableCount;
-    ss << " :total-alist-entries " << this->calculateHashTableCount();
+    ss << "#<" << this->_instanceClass()->_classNameAsString() << " :count " << this->hashTableCount();
+    if (this->shardedp()) ss << " :shards " << this->_Shards->length();
+    ss << " :capacity " << this->hashTableNumberOfHashes();
+    ss << " :deleted " << this->_HashTableDeleted;
     ss << " @" << (void *)(this) << "> ";
     return ss.str();
   //	return this->hash_table_dump();
@@ -755,50 +851,53 @@ List_sp HashTable_O::tableRef_no_lock(T_sp key) {
 
 #define DUMP_LOW_LEVEL 1
 
-  void dump_one_entry(HashTable_sp ht, size_t it, stringstream &ss, List_sp first) {
-    for (auto cur : first) {
-      List_sp pair = oCar(cur);
-      T_sp key = oCar(pair);
-      T_sp value = oCdr(pair);
+  void dump_one_entry(HashTable_sp ht, size_t it, stringstream &ss) {
+    T_sp key = ht->entryKey(it);
+    T_sp value = ht->entryValue(it);
+    if (key.unboundp()) return;
+    ss << "HashTable[" << it << "]: ";
+    if (key.deletedp()) {
+      ss << "deleted" << std::endl;
+      return;
+    }
 #ifdef DUMP_LOW_LEVEL
-      ss << "     ( ";
-      size_t hi = ht->hashIndex(key);
-      if (hi != it)
-        ss << "!!!ERROR-wrong bucket!!! hi=" << hi;
-      ss << "hashIndex(key)=" << ht->hashIndex(key) << " ";
-      if ((key).consp()) {
-        List_sp ckey = key;
-        ss << "(cons " << oCar(ckey).raw_() << " . " << oCdr(ckey).raw_() << ")";
-      } else {
-        ss << key.raw_();
-      }
-      ss << ", " << value.raw_() << ")@" << pair.raw_() << " " << std::endl;
+    ss << "( ";
+    size_t mask = ht->tableCapacity() - 1;
+    size_t hi = ht->hashIndex(key);
+    size_t home = (*ht->_HashTable)[it * HashTable_O::EntryStride + HashTable_O::HashOffset].unsafe_fixnum() & mask;
+    if (hi != home)
+      ss << "!!!ERROR-stale hash!!! hi=" << hi << " ";
+    ss << "hashIndex(key)=" << home << " probe=" << ((it - home) & mask) << " ";
+    if ((key).consp()) {
+      List_sp ckey = key;
+      ss << "(cons " << oCar(ckey).raw_() << " . " << oCdr(ckey).raw_() << ")";
+    } else {
+      ss << key.raw_();
+    }
+    ss << ", " << value.raw_() << ")" << std::endl;
 #else
-      ss << "     " << _rep_(pair) << std::endl;
+    ss << _rep_(key) << " " << _rep_(value) << std::endl;
 #endif
-    }
   };
   CL_LISPIFY_NAME("core:hashTableDump");
   CL_DEFMETHOD string HashTable_O::hash_table_dump(Fixnum start, T_sp end) const {
     stringstream ss;
-    HT_READ_LOCK(this);
 #ifndef DUMP_LOW_LEVEL
     ss << "#<" << this->_instanceClass()->_classNameAsString() << std::endl;
 #endif
-    int iend(cl__length(ENSURE_VALID_OBJECT(this->_HashTable)));
+    Fixnum capacity = this->tableCapacity();
+    Fixnum iend(capacity);
     if (end.notnilp()) {
       iend = clasp_to_fixnum(end);
     }
-    if (start < 0 || start >= cl__length(ENSURE_VALID_OBJECT(this->_HashTable))) {
-      SIMPLE_ERROR(BF("start must be [0,%d)") % cl__length(ENSURE_VALID_OBJECT(this->_HashTable)));
+    if (start < 0 || start >= capacity) {
+      SIMPLE_ERROR(BF("start must be [0,%d)") % capacity);
     }
-    if (iend < start || iend > cl__length(ENSURE_VALID_OBJECT(this->_HashTable))) {
-      SIMPLE_ERROR(BF("end must be nil or [%d,%d)") % start % cl__length(ENSURE_VALID_OBJECT(this->_HashTable)));
+    if (iend < start || iend > capacity) {
+      SIMPLE_ERROR(BF("end must be nil or [%d,%d)") % start % capacity);
     }
     for (size_t it(start), itEnd(iend); it < itEnd; ++it) {
-      List_sp first = ENSURE_VALID_OBJECT(this->_HashTable)->operator[](it);
-      ss << "HashTable[" << it << "]: " << std::endl;
-      dump_one_entry(this->asSmartPtr(), it, ss, first);
+      dump_one_entry(this->asSmartPtr(), it, ss);
     }
 #ifndef DUMP_LOW_LEVEL
     ss << "> " << std::endl;
@@ -807,77 +906,76 @@ List_sp HashTable_O::tableRef_no_lock(T_sp key) {
   }
 
   void HashTable_O::mapHash(std::function<void(T_sp, T_sp)> const &fn) {
-    HT_READ_LOCK(this);
-    VectorObjects_sp table = ENSURE_VALID_OBJECT(this->_HashTable);
-    for (size_t it(0), itEnd(cl__length(table)); it < itEnd; ++it) {
-      List_sp first = coerce_to_list((*table)[it]);
-      for (auto cur : first) {
-        List_sp pair = oCar(cur);
-        T_sp key = oCar(pair);
-        T_sp value = oCdr(pair);
-        if (!value.unboundp())
-          fn(key, value);
+    if (this->shardedp()) {
+      for (size_t is = 0, isEnd = this->_Shards->length(); is < isEnd; ++is) {
+        this->shard(is)->mapHash(fn);
       }
+      return;
+    }
+    SimpleVector_sp table = ENSURE_VALID_OBJECT(this->loadTable());
+    T_sp key, value;
+    for (size_t it(0), itEnd(table->length() / EntryStride); it < itEnd; ++it) {
+      if (readEntry(*table, it, key, value))
+        fn(key, value);
     }
   }
 
   bool HashTable_O::map_while_true(std::function<bool(T_sp, T_sp)> const &fn) const {
-  //        HASH_TABLE_LOCK();
-    HT_READ_LOCK(this);
-    VectorObjects_sp table = ENSURE_VALID_OBJECT(this->_HashTable);
-    for (size_t it(0), itEnd(cl__length(table)); it < itEnd; ++it) {
-      List_sp first = (*table)[it];
-      for (auto cur : first) {
-        List_sp pair = oCar(cur);
-        T_sp key = oCar(pair);
-        T_sp value = oCdr(pair);
-        if (!value.unboundp()) {
-          bool cont = fn(key, value);
-          if (!cont)
-            return false;
-        }
+    if (this->shardedp()) {
+      for (size_t is = 0, isEnd = this->_Shards->length(); is < isEnd; ++is) {
+        if (!this->shard(is)->map_while_true(fn)) return false;
+      }
+      return true;
+    }
+    SimpleVector_sp table = ENSURE_VALID_OBJECT(this->loadTable());
+    T_sp key, value;
+    for (size_t it(0), itEnd(table->length() / EntryStride); it < itEnd; ++it) {
+      if (readEntry(*table, it, key, value)) {
+        bool cont = fn(key, value);
+        if (!cont)
+          return false;
       }
     }
     return true;
   }
 
   void HashTable_O::lowLevelMapHash(KeyValueMapper *mapper) const {
-    HT_READ_LOCK(this);
-    VectorObjects_sp table = ENSURE_VALID_OBJECT(this->_HashTable);
-    for (size_t it(0), itEnd(cl__length(table)); it < itEnd; ++it) {
-      T_sp first = (*table)[it];
-      List_sp l = coerce_to_list(first);
-      for (auto cur : l) {
-      //Cons_sp cur(*it); //it.asCons());
-      //		Cons_sp cur(reinterpret_cast<core::Cons_O*>(it));
-
-      //	    for ( auto it = l.begin(); it != l.end(); ++it ) {
-      //Cons_sp cur(reinterpret_cast<core::Cons_O*>(&**it));
-      //	    	for ( Cons_sp cur=first.as<List_V>(); cur.consp(); cur = cCdr(cur) )
-        Cons_sp pair = gc::As<Cons_sp>(oCar(cur));
-        T_sp key = oCar(pair);
-        T_sp value = oCdr(pair);
-        if (!value.unboundp()) {
-          if (!mapper->mapKeyValue(key, value))
-            goto DONE;
-        }
+    if (this->shardedp()) {
+      // Stop at the first shard whose mapping was cut short
+      for (size_t is = 0, isEnd = this->_Shards->length(); is < isEnd; ++is) {
+        if (!this->shard(is)->map_while_true([mapper](T_sp key, T_sp value) { return mapper->mapKeyValue(key, value); })) return;
+      }
+      return;
+    }
+    SimpleVector_sp table = ENSURE_VALID_OBJECT(this->loadTable());
+    T_sp key, value;
+    for (size_t it(0), itEnd(table->length() / EntryStride); it < itEnd; ++it) {
+      if (readEntry(*table, it, key, value)) {
+        if (!mapper->mapKeyValue(key, value))
+          return;
       }
     }
-  DONE:
-    return;
   }
 
   CL_LISPIFY_NAME("core:hashTableNumberOfHashes");
   CL_DEFMETHOD int HashTable_O::hashTableNumberOfHashes() const {
-    HT_READ_LOCK(this);
-    return cl__length(ENSURE_VALID_OBJECT(this->_HashTable));
+    if (this->shardedp()) {
+      int capacity = 0;
+      for (size_t is = 0, isEnd = this->_Shards->length(); is < isEnd; ++is) {
+        capacity += this->shard(is)->hashTableNumberOfHashes();
+      }
+      return capacity;
+    }
+    return this->loadTable()->length() / EntryStride;
   }
 
   CL_LISPIFY_NAME("core:hashTableAlistAtHash");
   CL_DEFMETHOD List_sp HashTable_O::hashTableAlistAtHash(int hash) const {
-    HT_READ_LOCK(this);
-    ASSERTF(hash >= 0 && hash < cl__length(ENSURE_VALID_OBJECT(this->_HashTable)), BF("Illegal hash value[%d] must between [0,%d)") % hash % cl__length(ENSURE_VALID_OBJECT(this->_HashTable)));
-    return ENSURE_VALID_OBJECT(this->_HashTable)->operator[](hash);
+    SimpleVector_sp table = this->loadTable();
+    ASSERTF(hash >= 0 && hash < table->length() / EntryStride, BF("Illegal hash value[%d] must between [0,%d)") % hash % (table->length() / EntryStride));
+    T_sp key, value;
+    if (!readEntry(*table, hash, key, value)) return _Nil<T_O>();
+    return Cons_O::create(Cons_O::create(key, value), _Nil<T_O>());
   }
 
   string HashTable_O::keysAsString() {
@@ -892,7 +990,6 @@ CL_LAMBDA(arg);
 CL_DECLARE();
 CL_DOCSTRING("hash-table-rehash-size");
 CL_DEFUN Number_sp cl__hash_table_rehash_size(HashTable_sp ht) {
-  HT_READ_LOCK(&*ht);
   return ht->_RehashSize;
 };
 
@@ -900,7 +997,6 @@ CL_LAMBDA(arg);
 CL_DECLARE();
 CL_DOCSTRING("hash-table-rehash-threshold");
 CL_DEFUN double cl__hash_table_rehash_threshold(HashTable_sp ht) {
-  HT_READ_LOCK(&*ht);
   return ht->_RehashThreshold;
 };
 
@@ -78,27 +78,10 @@ HashTableEq_sp HashTableEq_O::createFromPList(List_sp plist, Symbol_sp nilTermin
   return ht;
 }
 
-List_sp HashTableEq_O::tableRef_no_lock(T_sp key) {
-    ASSERT(gc::IsA<Array_sp>(this->_HashTable));
-    cl_index length = ENSURE_VALID_OBJECT(this->_HashTable)->length();
-    cl_index index = this->safe_sxhashKey(key, length, false);
-    List_sp pair = _Nil<T_O>();
-    for (auto cur : gc::As_unsafe<List_sp>((*ENSURE_VALID_OBJECT(this->_HashTable))[index])) {
-      pair = CONS_CAR(cur);
-      ASSERT(pair.consp());
-      if (CONS_CAR(pair) == key) return pair;
-    }
-#if defined(USE_MPS)
-  // Location dependency test if key is stale
-    if (key.objectp()) {
-      void *blockAddr = &(*key);
-      if (mps_ld_isstale(const_cast<mps_ld_t>(&(this->_LocationDependency)), global_arena, blockAddr)) {
-        return this->rehash_no_lock(false, key);
-      }
-    }
-#endif
-    return _Nil<T_O>();
-  }
+gc::Fixnum HashTableEq_O::findEntry(SimpleVector_O &table, T_sp key, gc::Fixnum hash, T_sp &value) const {
+  // EQ only needs to compare pointers - skip the virtual keyTest
+  return probe(table, key, hash, [](T_sp entryKey, T_sp searchKey) { return entryKey.raw_() == searchKey.raw_(); }, value);
+}
 
 
 bool HashTableEq_O::keyTest(T_sp entryKey, T_sp searchKey) const {
@@ -113,7 +96,7 @@ gc::Fixnum HashTableEq_O::sxhashKey(T_sp obj, gc::Fixnum bound, bool willAddKey)
 #ifdef USE_BOEHM
   HashTable_O::sxhash_eq(hg, obj, NULL);
 #endif
-  return hg.hashBound(bound);
+  return hg.hash(bound);
 }
 
 }; /* core */
@@ -84,7 +84,7 @@ gc::Fixnum HashTableEql_O::sxhashKey(T_sp obj, gc::Fixnum bound, bool willAddKey
 #else
   HashTable_O::sxhash_eql(hg, obj, NULL);
 #endif
-  gc::Fixnum hash = hg.hashBound(bound);
+  gc::Fixnum hash = hg.hash(bound);
   LOG(BF("HashTableEql_O::sxhashKey obj[%s] raw_hash[%s] bound[%d] hash[%d]") % _rep_(obj) % hg.asString() % bound % hash);
   return hash;
 }
@@ -47,11 +47,13 @@ THE SOFTWARE.
 #include <clasp/core/multipleValues.h>
 #include <clasp/core/evaluator.h>
 #include <clasp/core/lispStream.h>
+#include <clasp/core/designators.h>
 #include <clasp/core/array.h>
 #include <clasp/core/specialForm.h>
 #include <clasp/core/cons.h>
 //#include "lisp_ParserExtern.h"
 #include <clasp/core/lispReader.h>
+#include <clasp/core/parse_float.h>
 #include <clasp/core/readtable.h>
 #include <clasp/core/wrappers.h>
 
@@ -69,19 +71,49 @@ namespace core {
 
 typedef Fixnum trait_chr_type;
 
+/*! Token character buffers are recycled per thread.  The reader is
+    reentrant (reader macros call READ) so each Token takes a buffer from
+    the pool when it is constructed and gives it back when it goes out of scope. */
+#define TOKEN_BUFFER_INITIAL_SIZE 64
+#define TOKEN_BUFFER_MAX_POOLED_SIZE 4096
+struct TokenBufferPool {
+  vector<vector<trait_chr_type>*> _Free;
+  ~TokenBufferPool() {
+    for ( auto buffer : this->_Free ) delete buffer;
+  }
+};
+
+THREAD_LOCAL TokenBufferPool threadTokenBufferPool;
+
 struct Token {
-  SourcePosInfo_sp sourcePosInfo;
-  vector<trait_chr_type>  chars;
-  void clear() { this->chars.clear();};
-  void recordSourcePos(SourcePosInfo_sp sp) {
-    this->sourcePosInfo = sp;
+  vector<trait_chr_type>* _Chars;
+  Token() {
+    if (threadTokenBufferPool._Free.empty()) {
+      this->_Chars = new vector<trait_chr_type>();
+      this->_Chars->reserve(TOKEN_BUFFER_INITIAL_SIZE);
+    } else {
+      this->_Chars = threadTokenBufferPool._Free.back();
+      threadTokenBufferPool._Free.pop_back();
+      this->_Chars->clear();
+    }
+  }
+  ~Token() {
+    if (this->_Chars->capacity() > TOKEN_BUFFER_MAX_POOLED_SIZE) {
+      delete this->_Chars;
+      return;
+    }
+    threadTokenBufferPool._Free.push_back(this->_Chars);
   }
-  trait_chr_type* data() { return this->chars.data();};
-  void push_back(trait_chr_type c) { this->chars.push_back(c); };
-  size_t size() const { return this->chars.size(); };
+  Token(const Token&) = delete;
+  Token& operator=(const Token&) = delete;
+  void clear() { this->_Chars->clear();};
+  trait_chr_type* data() { return this->_Chars->data();};
+  const trait_chr_type* data() const { return this->_Chars->data();};
+  void push_back(trait_chr_type c) { this->_Chars->push_back(c); };
+  size_t size() const { return this->_Chars->size(); };
   
-  trait_chr_type& operator[](int i) { return this->chars[i]; };
-  const trait_chr_type& operator[](int i) const { return this->chars[i]; };
+  trait_chr_type& operator[](int i) { return (*this->_Chars)[i]; };
+  const trait_chr_type& operator[](int i) const { return (*this->_Chars)[i]; };
 };
   
 #define TRAIT_DIGIT          0x000100000000
@@ -126,14 +158,12 @@ SYMBOL_EXPORT_SC_(ClPkg, STARread_suppressSTAR);
 // -----------
 
 /*! Return a uint that combines the character x with its character TRAITs
-      See CLHS 2.1.4.2 */
-trait_chr_type constituentChar(Character_sp ch, trait_chr_type trait = 0) {
-  claspCharacter x = ch.unsafe_character();
+      See CLHS 2.1.4.2
+    read_base is the value of *read-base* - callers look it up once per token. */
+trait_chr_type constituentChar(claspCharacter x, trait_chr_type read_base) {
   ASSERT(x<CHAR_MASK);
-  if (trait != 0) return (x | trait);
-  trait_chr_type result = 0;
-  trait_chr_type read_base = unbox_fixnum(gc::As<Fixnum_sp>(cl::_sym_STARread_baseSTAR->symbolValue()));
   ASSERT(read_base>=2 && read_base<=36);
+  trait_chr_type result = 0;
   if (x >= '0' && x <= '9') {
     trait_chr_type uix = x - '0';
     if (uix < read_base) {
@@ -179,80 +209,60 @@ LETTER:
   return result;
 }
 
-T_sp constituentCharAsFixnum(Character_sp ch, trait_chr_type trait = 0 ) {
-  trait_chr_type ct = constituentChar(ch,trait);
-  return core::make_fixnum((Fixnum)ct);
-}
-
-
-// -----------------------------------------------------------
-//
-// Read symbols for reader macros #: and #\
-//
-
-/*! See SACLA reader.lisp::read-ch */
-T_sp read_ch(T_sp sin) {
-  T_sp nc = cl__read_char(sin, _Nil<T_O>(), _Nil<T_O>(), _lisp->_true());
-  return nc;
+/*! A character read while escaped is always alphabetic */
+inline trait_chr_type escapedChar(claspCharacter x) {
+  return (x | TRAIT_ALPHABETIC | TRAIT_ESCAPED);
 }
 
-/*! See SACLA reader.lisp::read-ch-or-die */
-Character_sp read_ch_or_die(T_sp sin) {
-  Character_sp nc = gc::As_unsafe<Character_sp>(cl__read_char(sin, _lisp->_true(), _Nil<T_O>(), _lisp->_true()));
-  return nc;
-}
+/*! Where the reader gets its characters from.
+    The stream designator and its dispatch table are resolved once per
+    object rather than going through CL:READ-CHAR for every character.
+    String input streams over a simple-base-string are scanned directly
+    out of the string.  Gray (CLOS) streams get the dispatch table that
+    calls their generic functions, so they behave as before. */
+struct ReaderInput {
+  T_sp _Stream;
+  claspCharacter (*_ReadChar)(T_sp);
+  void (*_UnreadChar)(T_sp, claspCharacter);
+  StringInputStream_sp _StringStream;
+  SimpleBaseString_sp _StringContents;
+  ReaderInput(T_sp sin) {
+    this->_Stream = coerce::inputStreamDesignator(sin);
+    const FileOps& ops = stream_dispatch_table(this->_Stream);
+    this->_ReadChar = ops.read_char;
+    this->_UnreadChar = ops.unread_char;
+    if (StringInputStream_sp ss = this->_Stream.asOrNull<StringInputStream_O>()) {
+      if (SimpleBaseString_sp contents = ss->_Contents.asOrNull<SimpleBaseString_O>()) {
+        this->_StringStream = ss;
+        this->_StringContents = contents;
+      }
+    }
+  }
+  /*! Return the next character or EOF */
+  inline claspCharacter read() {
+    if (this->_StringContents) {
+      gctools::Fixnum pos = this->_StringStream->_InputPosition;
+      if (pos >= this->_StringStream->_InputLimit) return EOF;
+      this->_StringStream->_InputPosition = pos + 1;
+      return (*this->_StringContents)[pos];
+    }
+    return this->_ReadChar(this->_Stream);
+  }
+  claspCharacter read_or_die() {
+    claspCharacter c = this->read();
+    if (c == EOF) ERROR_END_OF_FILE(this->_Stream);
+    return c;
+  }
+  void unread(claspCharacter c) {
+    this->_UnreadChar(this->_Stream, c);
+  }
+};
 
 /*! See SACLA reader.lisp::unread-ch */
 void unread_ch(T_sp sin, Character_sp c) {
   clasp_unread_char(clasp_as_claspCharacter(c), sin);
 }
 
-/*! See SACLA reader.lisp::collect-escaped-lexemes */
-List_sp collect_escaped_lexemes(Character_sp c, T_sp sin) {
-  ReadTable_sp readTable = gc::As<ReadTable_sp>(_lisp->getCurrentReadTable());
-  Symbol_sp syntax_type = readTable->syntax_type(c);
-  if (syntax_type == kw::_sym_invalid) {
-    SIMPLE_ERROR(BF("invalid-character-error: %s") % _rep_(c));
-  } else if (syntax_type == kw::_sym_multiple_escape) {
-    return _Nil<T_O>();
-  } else if (syntax_type == kw::_sym_single_escape) {
-    return Cons_O::create(constituentCharAsFixnum(read_ch_or_die(sin),TRAIT_ESCAPED),
-                          collect_escaped_lexemes(read_ch_or_die(sin), sin));
-  } else if (syntax_type == kw::_sym_constituent || syntax_type == kw::_sym_whitespace || syntax_type == kw::_sym_terminating_macro || syntax_type == kw::_sym_non_terminating_macro) {
-    return Cons_O::create(constituentCharAsFixnum(c,TRAIT_ESCAPED), collect_escaped_lexemes(read_ch_or_die(sin), sin));
-  }
-  return _Nil<T_O>();
-}
-
-/*! See SACLA reader.lisp::collect-lexemes.
-    Set extended to true if a non base-char is seen.*/
-List_sp collect_lexemes(/*Character_sp*/ T_sp tc, T_sp sin) {
-  if (tc.notnilp()) {
-    Character_sp c = gc::As<Character_sp>(tc);
-    ReadTable_sp readTable = gc::As<ReadTable_sp>(_lisp->getCurrentReadTable());
-    Symbol_sp syntax_type = readTable->syntax_type(c);
-    if (syntax_type == kw::_sym_invalid) {
-      SIMPLE_ERROR(BF("invalid-character-error: %s") % _rep_(c));
-    } else if (syntax_type == kw::_sym_whitespace) {
-      if (_sym_STARpreserve_whitespace_pSTAR->symbolValue().isTrue()) {
-        unread_ch(sin, c);
-      }
-    } else if (syntax_type == kw::_sym_terminating_macro) {
-      unread_ch(sin, c);
-    } else if (syntax_type == kw::_sym_multiple_escape) {
-      return Cons_O::create(collect_escaped_lexemes(read_ch_or_die(sin), sin),
-                            collect_lexemes(read_ch(sin), sin));
-    } else if (syntax_type == kw::_sym_single_escape) {
-      return Cons_O::create(Cons_O::create(constituentCharAsFixnum(read_ch_or_die(sin)),_Nil<T_O>()),
-                            collect_lexemes(read_ch(sin), sin));
-    } else if (syntax_type == kw::_sym_constituent || syntax_type == kw::_sym_non_terminating_macro) {
-      return Cons_O::create(constituentCharAsFixnum(c), collect_lexemes(read_ch(sin), sin));
-    }
-  }
-  return _Nil<T_O>();
-}
-
-
 typedef enum {undefined, up, down, mixed } UnEscapedCase;
 
 UnEscapedCase case_state(Fixnum c, UnEscapedCase curCase) {
@@ -279,127 +289,54 @@ UnEscapedCase case_state(Fixnum c, UnEscapedCase curCase) {
 }
 
 
-UnEscapedCase check_case(List_sp cur_char, UnEscapedCase curCase) {
-  while (cur_char.notnilp()) {
-    T_sp obj = oCar(cur_char);
-    if (obj.consp()) {
-      return check_case(obj,curCase);
-    } else if (obj.fixnump()) {
-      curCase = case_state(obj.unsafe_fixnum(),curCase);
-    } else if (obj.nilp()) {
-      return curCase;
+/*! The characters of a float token as a C string for strtod/strtof/strtold.
+    Any exponent marker is turned into 'e'.  Tokens that fit are copied
+    into a buffer on the stack. */
+#define FLOAT_TOKEN_SMALL_SIZE 128
+struct FloatTokenChars {
+  char _Small[FLOAT_TOKEN_SMALL_SIZE];
+  std::string _Large;
+  const char* _Chars;
+  FloatTokenChars(const trait_chr_type* cur, const trait_chr_type* end) {
+    size_t len = end - cur;
+    char* buffer = this->_Small;
+    if (len >= FLOAT_TOKEN_SMALL_SIZE) {
+      this->_Large.resize(len);
+      buffer = &this->_Large[0];
     }
-    cur_char = oCdr(cur_char);
-  }
-  return curCase;
-}
-
-
-Character_sp lexeme_character(T_sp lexeme) {
-  if (lexeme.fixnump()) {
-    return core::clasp_make_character(CHR(lexeme));
-  }
-  SIMPLE_ERROR(BF("Unknown lexeme %s") % _rep_(lexeme));
-}
-
-void make_str_upcase(StrNs_sp sout, List_sp cur_char) {
-  while (cur_char.notnilp()) {
-    T_sp obj = oCar(cur_char);
-    if (obj.consp()) {
-      make_str_upcase(sout, obj);
-    } else if (obj.fixnump()) {
-      if (obj.unsafe_fixnum()&TRAIT_ESCAPED)
-        sout->vectorPushExtend(core::clasp_make_character(CHR(obj.unsafe_fixnum())));
-      else sout->vectorPushExtend(core::clasp_make_character(toupper(CHR(obj.unsafe_fixnum()))));
-    } else if (obj.nilp()) {
-      // Handling name ||   do nothing
+    for ( size_t i(0); i<len; ++i ) {
+      trait_chr_type c = cur[i];
+      buffer[i] = TRAIT_MATCH_ANY(c, TRAIT_EXPONENTMARKER) ? 'e' : (char)CHR(c);
     }
-    cur_char = oCdr(cur_char);
-  }
-}
-
-void make_str_downcase(StrNs_sp sout, List_sp cur_char) {
-  while (cur_char.notnilp()) {
-    T_sp obj = oCar(cur_char);
-    if (obj.consp()) {
-      make_str_downcase(sout, obj);
-    } else if (obj.fixnump()) {
-      if (obj.unsafe_fixnum()&TRAIT_ESCAPED)
-        sout->vectorPushExtend(core::clasp_make_character(CHR(obj.unsafe_fixnum())));
-      else sout->vectorPushExtend(core::clasp_make_character(tolower(CHR(obj.unsafe_fixnum()))));
-    } else if (obj.nilp()) {
-      // Handling name ||   do nothing
+    if (len >= FLOAT_TOKEN_SMALL_SIZE) {
+      this->_Chars = this->_Large.c_str();
+    } else {
+      buffer[len] = '\0';
+      this->_Chars = buffer;
     }
-    cur_char = oCdr(cur_char);
   }
-}
+  FloatTokenChars(const FloatTokenChars&) = delete;
+  const char* c_str() const { return this->_Chars; };
+};
 
-void make_str_preserve_case(StrNs_sp sout, List_sp cur_char) {
-  while (cur_char.notnilp()) {
-    T_sp obj = oCar(cur_char);
-    if (obj.consp()) {
-      make_str_preserve_case(sout, obj);
-    } else if (obj.fixnump()) {
-      sout->vectorPushExtend(core::clasp_make_character(CHR(obj.unsafe_fixnum())));
-    } else if (obj.nilp()) {
-      // Handling name ||   do nothing
-    }
-    cur_char = oCdr(cur_char);
-  }
+/*! Convert a float token exactly, the text is only copied out for
+    strtod/strtof in the rare cases that need big arithmetic */
+static double token_double(const trait_chr_type* start, const trait_chr_type* end) {
+  DecimalFloat dec;
+  scan_decimal_float(end - start, [start](size_t i) { return CHR(start[i]); }, dec);
+  double d;
+  if (decimal_float_to_double(dec, d)) return d;
+  FloatTokenChars numstr(start, end);
+  return ::strtod(numstr.c_str(), NULL);
 }
 
-/*! Works like SACLA readtable::make-str but accumulates the characters
-      into a stringstream */
-void make_str(StrNs_sp sout, List_sp cur_char) {
-  ReadTable_sp readtable = gc::As<ReadTable_sp>(cl::_sym_STARreadtableSTAR->symbolValue());
-  if (readtable->_Case == kw::_sym_invert) {
-    UnEscapedCase strcase = check_case(cur_char,undefined);
-    switch (strcase) {
-      case undefined:
-      case mixed:
-          make_str_preserve_case(sout,cur_char);
-          return;
-      case up:
-          make_str_downcase(sout,cur_char);
-          return;
-      case down:
-          make_str_upcase(sout,cur_char);
-          return;
-      }
-    UNREACHABLE();
-  } else if (readtable->_Case == kw::_sym_upcase) {
-    make_str_upcase(sout,cur_char);
-  } else if (readtable->_Case == kw::_sym_downcase) {
-    make_str_downcase(sout,cur_char);
-  } else if (readtable->_Case == kw::_sym_preserve) {
-    make_str_preserve_case(sout,cur_char);
-  } else {
-    SIMPLE_ERROR(BF("Bad readtable case %s") % _rep_(readtable->_Case));
-  }
-}
-
-string fix_exponent_char(const char *cur) {
-  stringstream ss;
-  while (*cur) {
-    if (isalpha(*cur)) {
-      char uc = toupper(*cur);
-      switch (uc) {
-      case 'D':
-      case 'E':
-      case 'F':
-      case 'L':
-      case 'S':
-        ss << "E";
-        break;
-      default:
-        SIMPLE_ERROR(BF("Illegal exponent character[%c]") % *cur);
-        break;
-      }
-    } else
-      ss << (*cur);
-    ++cur;
-  }
-  return ss.str();
+static float token_float(const trait_chr_type* start, const trait_chr_type* end) {
+  DecimalFloat dec;
+  scan_decimal_float(end - start, [start](size_t i) { return CHR(start[i]); }, dec);
+  float f;
+  if (decimal_float_to_float(dec, f)) return f;
+  FloatTokenChars numstr(start, end);
+  return ::strtof(numstr.c_str(), NULL);
 }
 
 typedef enum {
@@ -532,18 +469,18 @@ void apply_readtable_case(Token& token, size_t start, size_t end) {
 }
 
 
-SimpleString_sp symbolTokenStr(T_sp stream, Token &token, size_t start, size_t end, bool only_dots_ok=false) {
-  bool extended = false;
-  SafeBufferStrWNs buffer;
+/*! Apply the readtable case to token[start,end) and accumulate it
+    into the symbol name buffer sout */
+void symbolTokenName(T_sp stream, Token &token, size_t start, size_t end, StrWNs_sp sout, bool only_dots_ok=false) {
   apply_readtable_case(token,start,end);
   bool only_dots = true;
   if ((end-start)==0) {
-    printf("%s:%d The symbolTokenStr is empty\n", __FILE__, __LINE__ );
+    printf("%s:%d The symbolTokenName is empty\n", __FILE__, __LINE__ );
   }
   for (size_t i=start,iEnd(end); i<iEnd; ++i) {
     claspCharacter c = CHR(token[i]);
     if (c != '.') only_dots = false;
-    buffer.string()->vectorPushExtend_claspCharacter(CHR(token[i]));
+    sout->vectorPushExtend_claspCharacter(c);
   }
   if ((end-start)>0) {
     if (only_dots) {
@@ -553,9 +490,74 @@ SimpleString_sp symbolTokenStr(T_sp stream, Token &token, size_t start, size_t e
       }
     }
   }
+}
+
+SimpleString_sp symbolTokenStr(T_sp stream, Token &token, size_t start, size_t end, bool only_dots_ok=false) {
+  SafeBufferStrWNs buffer;
+  symbolTokenName(stream,token,start,end,buffer.string(),only_dots_ok);
   return buffer.string()->asMinimalSimpleString();
 }
 
+/*! Intern the symbol named by token[start,end) in package.
+    The name is looked up while it is still in the thread's buffer string,
+    a simple-string is only allocated when a new symbol has to be created. */
+Symbol_sp internToken(T_sp stream, Token &token, size_t start, size_t end, bool only_dots_ok, Package_sp package) {
+  SafeBufferStrWNs buffer;
+  symbolTokenName(stream,token,start,end,buffer.string(),only_dots_ok);
+  Symbol_mv found = package->findSymbol(buffer.string());
+  Symbol_sp sym = found;
+  T_sp status = found.second();
+  if (status.notnilp()) return sym;
+  return gc::As<Symbol_sp>(package->intern(buffer.string()->asMinimalSimpleString()));
+}
+
+/*! Read the rest of a token that begins with ch (see SACLA reader.lisp::collect-lexemes)
+    and accumulate its characters into sout.  The readtable case is applied
+    to unescaped characters unless preserve_case is true.
+    This is used by reader macros like #\ and #: */
+void collect_token_string(Character_sp ch, T_sp sin, StrNs_sp sout, bool preserve_case) {
+  ReaderInput input(sin);
+  ReadTable_sp readTable = gc::As<ReadTable_sp>(_lisp->getCurrentReadTable());
+  Token token;
+  claspCharacter c = clasp_as_claspCharacter(ch);
+  while (c != EOF) {
+    ReadTableSyntax syntax_type = readTable->syntax_code(c);
+    if (syntax_type == syntax_invalid) {
+      SIMPLE_ERROR(BF("invalid-character-error: %s") % _rep_(clasp_make_character(c)));
+    } else if (syntax_type == syntax_whitespace) {
+      if (_sym_STARpreserve_whitespace_pSTAR->symbolValue().isTrue()) {
+        input.unread(c);
+      }
+      break;
+    } else if (syntax_type == syntax_terminating_macro) {
+      input.unread(c);
+      break;
+    } else if (syntax_type == syntax_multiple_escape) {
+      while (true) {
+        claspCharacter e = input.read_or_die();
+        ReadTableSyntax escaped_syntax_type = readTable->syntax_code(e);
+        if (escaped_syntax_type == syntax_invalid) {
+          SIMPLE_ERROR(BF("invalid-character-error: %s") % _rep_(clasp_make_character(e)));
+        } else if (escaped_syntax_type == syntax_multiple_escape) {
+          break;
+        } else if (escaped_syntax_type == syntax_single_escape) {
+          e = input.read_or_die();
+        }
+        token.push_back(escapedChar(e));
+      }
+    } else if (syntax_type == syntax_single_escape) {
+      token.push_back(escapedChar(input.read_or_die()));
+    } else {
+      token.push_back(c);
+    }
+    c = input.read();
+  }
+  if (!preserve_case) apply_readtable_case(token,0,token.size());
+  for ( size_t i(0); i<token.size(); ++i ) {
+    sout->vectorPushExtend(clasp_make_character(CHR(token[i])));
+  }
+}
+
 SimpleString_sp tokenStr(T_sp stream, const Token &token, size_t start = 0, size_t end = UNDEF_UINT, bool only_dots_ok=false) {
   bool extended = false;
   if (end==UNDEF_UINT) end = token.size();
@@ -738,9 +740,8 @@ T_sp interpret_token_or_throw_reader_error(T_sp sin, Token &token, bool only_dot
     // interpret symbols in current package
     {
       if (cl::_sym_STARread_suppressSTAR->symbolValue().isTrue()) return _Nil<T_O>();
-      SimpleString_sp sym_name = symbolTokenStr(sin,token, name_marker - token.data(),token.size(),only_dots_ok);
-      Symbol_sp sym = _lisp->getCurrentPackage()->intern(sym_name);
-      LOG_READ(BF("sym_name = |%s| sym->symbolNameAsString() = |%s|") % sym_name->get_std_string() % sym->symbolNameAsString());
+      Symbol_sp sym = internToken(sin,token, name_marker - token.data(),token.size(),only_dots_ok,_lisp->getCurrentPackage());
+      LOG_READ(BF("sym->symbolNameAsString() = |%s|") % sym->symbolNameAsString());
       return sym;
     }
     break;
@@ -762,22 +763,22 @@ T_sp interpret_token_or_throw_reader_error(T_sp sin, Token &token, bool only_dot
       ++separator;
       ++cur;
     }
-    // TODO Handle proper string names
-    SimpleString_sp symbol_name_str = symbolTokenStr(sin,token, name_marker - token.data(),token.size(),only_dots_ok);
-    LOG_READ(BF("Interpreting token as packageName[%s] and symbol-name[%s]") % _rep_(packageSin.string()) % symbol_name_str->get_std_string());
     // TODO Deal with proper string package names
     string packageName = packageSin.string()->get_std_string();
     Package_sp pkg = gc::As<Package_sp>(_lisp->findPackage(packageName, true));
     Symbol_sp sym;
     if (separator == 1) { // Asking for external symbol
-      Symbol_mv sym_mv = pkg->findSymbol_SimpleString(symbol_name_str);
+      SafeBufferStrWNs symbolName;
+      symbolTokenName(sin,token, name_marker - token.data(),token.size(),symbolName.string(),only_dots_ok);
+      LOG_READ(BF("Interpreting token as packageName[%s] and symbol-name[%s]") % packageName % symbolName.string()->get_std_string());
+      Symbol_mv sym_mv = pkg->findSymbol(symbolName.string());
       sym = sym_mv;
       T_sp status = sym_mv.second();
       if (status != kw::_sym_external) {
-        SIMPLE_ERROR(BF("Cannot find the external symbol %s in %s") % symbol_name_str->get_std_string() % _rep_(pkg));
+        SIMPLE_ERROR(BF("Cannot find the external symbol %s in %s") % symbolName.string()->get_std_string() % _rep_(pkg));
       }
     } else {
-      sym = pkg->intern(symbol_name_str);
+      sym = internToken(sin,token, name_marker - token.data(),token.size(),only_dots_ok,pkg);
     }
     ASSERT(sym);
     return sym;
@@ -787,8 +788,7 @@ T_sp interpret_token_or_throw_reader_error(T_sp sin, Token &token, bool only_dot
       return _Nil<T_O>();
     // interpret good keywords
     LOG_READ(BF("Token[%s] interpreted as keyword") % name_marker);
-    SimpleString_sp keyword_name = symbolTokenStr(sin,token, name_marker - token.data(),token.size(),only_dots_ok);
-    return _lisp->keywordPackage()->intern(keyword_name);
+    return internToken(sin,token, name_marker - token.data(),token.size(),only_dots_ok,_lisp->keywordPackage());
   } break;
   case tsymk:{
     if (cl::_sym_STARread_suppressSTAR->symbolValue().isTrue()) return _Nil<T_O>();
@@ -812,17 +812,41 @@ T_sp interpret_token_or_throw_reader_error(T_sp sin, Token &token, bool only_dot
       ASSERT(cl::_sym_STARread_baseSTAR->symbolValue().fixnump());
       int read_base = cl::_sym_STARread_baseSTAR->symbolValue().unsafe_fixnum();
       ASSERT(read_base>=2 && read_base<=36);
-      SimpleString_sp ssnum = tokenStr(sin,token, start - token.data());
-      string num = ssnum->get_std_string();
-      if (num[0] == '+') num = num.substr(1,num.size());
-      try {
-        if (num[num.size() - 1] == '.') {
-          mpz_class z10(num.substr(0, num.size() - 1), 10);
-          return Integer_O::create(z10);
-        } else {
-          mpz_class zbase(num.c_str(), read_base);
-          return Integer_O::create(zbase);
+      // A trailing decimal point means the integer is in radix 10
+      int base = (state == tintp) ? 10 : read_base;
+      const trait_chr_type *digits = start;
+      const trait_chr_type *digits_end = (state == tintp) ? end - 1 : end;
+      bool negative = false;
+      if (CHR(*digits) == '+') {
+        ++digits;
+      } else if (CHR(*digits) == '-') {
+        negative = true;
+        ++digits;
+      }
+      // Accumulate fixnums directly from the token
+      gc::Fixnum value = 0;
+      bool use_gmp = false;
+      for ( cur = digits; cur != digits_end; ++cur ) {
+        claspCharacter c = CHR(*cur);
+        int digit;
+        if (c >= '0' && c <= '9') digit = c - '0';
+        else if (c >= 'a' && c <= 'z') digit = c - 'a' + 10;
+        else digit = c - 'A' + 10;
+        if (digit >= base || value > (gc::most_positive_fixnum - digit) / base) {
+          use_gmp = true;
+          break;
         }
+        value = value * base + digit;
+      }
+      if (!use_gmp) return clasp_make_fixnum(negative ? -value : value);
+      // Bignums (and malformed digits, which GMP reports) go through GMP
+      string num;
+      num.reserve(digits_end - start);
+      if (negative) num.push_back('-');
+      for ( cur = digits; cur != digits_end; ++cur ) num.push_back((char)CHR(*cur));
+      try {
+        mpz_class zbase(num.c_str(), base);
+        return Integer_O::create(zbase);
       } catch (std::invalid_argument &arg) {
         SIMPLE_ERROR(BF("Problem in mpz_class creation with %s error: %s") % num % arg.what());
       }
@@ -847,69 +871,40 @@ T_sp interpret_token_or_throw_reader_error(T_sp sin, Token &token, bool only_dot
   case tfloatp:
     // interpret float
     {
+      T_sp float_format;
       switch (exponent) {
-      case undefined_exp: {
-        char *lastValid = NULL;
-        if (cl::_sym_STARreadDefaultFloatFormatSTAR->symbolValue() == cl::_sym_single_float) {
-          string numstr = tokenStr(sin,token, start - token.data())->get_std_string();
-          float f = ::strtof(numstr.c_str(), &lastValid);
-          return clasp_make_single_float(f);
-        } else if (cl::_sym_STARreadDefaultFloatFormatSTAR->symbolValue() == cl::_sym_DoubleFloat_O) {
-          string numstr = tokenStr(sin,token, start - token.data())->get_std_string();
-          double d = ::strtod(numstr.c_str(), &lastValid);
-          return DoubleFloat_O::create(d);
-        }
-        else if (cl::_sym_STARreadDefaultFloatFormatSTAR->symbolValue() == cl::_sym_ShortFloat_O) {
-          string numstr = tokenStr(sin,token, start - token.data())->get_std_string();
-          float f = ::strtof(numstr.c_str(), &lastValid);
-          return clasp_make_single_float(f); //ShortFloat_O::create(f) crashes
-        }
-        else if (cl::_sym_STARreadDefaultFloatFormatSTAR->symbolValue() == cl::_sym_LongFloat_O) {
-          string numstr = tokenStr(sin,token, start - token.data())->get_std_string();
-          LongFloat l = ::strtod(numstr.c_str(), &lastValid);
-          return LongFloat_O::create(l);
-        }
-        else {
-          SIMPLE_ERROR(BF("Handle *read-default-float-format* of %s") % _rep_(cl::_sym_STARreadDefaultFloatFormatSTAR->symbolValue()));
-        }
-      }
-      case float_exp: {
-        char *lastValid = NULL;
-        string numstr = fix_exponent_char(tokenStr(sin,token, start - token.data())->get_std_string().c_str());
-        double d = ::strtod(numstr.c_str(), &lastValid);
-        return DoubleFloat_O::create(d);
-      }
-      case short_float_exp: {
-        char *lastValid = NULL;
-        string numstr = fix_exponent_char(tokenStr(sin,token, start - token.data())->get_std_string().c_str());
-        double d = ::strtod(numstr.c_str(), &lastValid);
-        return clasp_make_single_float(d);
-      }
-      case single_float_exp: {
-        char *lastValid = NULL;
-        string numstr = fix_exponent_char(tokenStr(sin,token, start - token.data())->get_std_string().c_str());
-        double d = ::strtod(numstr.c_str(), &lastValid);
-        return clasp_make_single_float(d);
-      }
-      case double_float_exp: {
-        char *lastValid = NULL;
-        string numstr = fix_exponent_char(tokenStr(sin,token, start - token.data())->get_std_string().c_str());
-        double d = ::strtod(numstr.c_str(), &lastValid);
-        return DoubleFloat_O::create(d);
-      }
+      case undefined_exp:
+      case float_exp:
+        float_format = cl::_sym_STARreadDefaultFloatFormatSTAR->symbolValue();
+        break;
+      case short_float_exp:
+        float_format = cl::_sym_ShortFloat_O;
+        break;
+      case single_float_exp:
+        float_format = cl::_sym_single_float;
+        break;
+      case double_float_exp:
+        float_format = cl::_sym_DoubleFloat_O;
+        break;
       case long_float_exp: {
-        char *lastValid = NULL;
-        string numstr = fix_exponent_char(tokenStr(sin,token, start - token.data())->get_std_string().c_str());
 #ifdef CLASP_LONG_FLOAT
-        LongFloat d = ::strtold(numstr.c_str(), &lastValid);
+        FloatTokenChars numstr(start, end);
+        LongFloat d = ::strtold(numstr.c_str(), NULL);
         return LongFloat_O::create(d);
 #else
-        double d = ::strtod(numstr.c_str(), &lastValid);
-        return DoubleFloat_O::create(d);
+        return DoubleFloat_O::create(token_double(start, end));
 #endif
       }
       }
-      SIMPLE_ERROR(BF("Shouldn't get here - unhandled exponent type"));
+      if (float_format == cl::_sym_single_float || float_format == cl::_sym_ShortFloat_O) {
+        return clasp_make_single_float(token_float(start, end)); //ShortFloat_O::create(f) crashes
+      } else if (float_format == cl::_sym_DoubleFloat_O) {
+        return DoubleFloat_O::create(token_double(start, end));
+      } else if (float_format == cl::_sym_LongFloat_O) {
+        LongFloat l = token_double(start, end);
+        return LongFloat_O::create(l);
+      }
+      SIMPLE_ERROR(BF("Handle *read-default-float-format* of %s") % _rep_(float_format));
     }
   }
   LOG_READ(BF("Bad state %d") % state);
@@ -1066,7 +1061,7 @@ T_sp read_lisp_object(T_sp sin, bool eofErrorP, T_sp eofValue, bool recursiveP)
       Read a character from the stream and based on what it is continue to process the
       stream until a complete symbol/number of macro is processed.
       Return the result in a MultipleValues object - if it is empty then nothing was read */
-__attribute__((optnone)) T_mv lisp_object_query(T_sp sin, bool eofErrorP, T_sp eofValue, bool recursiveP) {
+T_mv lisp_object_query(T_sp sin, bool eofErrorP, T_sp eofValue, bool recursiveP) {
 #if 0
   static int monitorReaderStep = 0;
   if ((monitorReaderStep % 1000) == 0 && cl__member(_sym_monitorReader, _sym_STARdebugMonitorSTAR->symbolValue(), _Nil<T_O>()).notnilp()) {
@@ -1075,52 +1070,55 @@ __attribute__((optnone)) T_mv lisp_object_query(T_sp sin, bool eofErrorP, T_sp e
   ++monitorReaderStep;
 #endif
   bool only_dots_ok = false;
+  ReaderInput input(sin);
+  sin = input._Stream;
   Token token;
   ReadTable_sp readTable = gc::As<ReadTable_sp>(_lisp->getCurrentReadTable());
-  Character_sp xxx, y, z, X, Y, Z;
+  trait_chr_type read_base = unbox_fixnum(gc::As<Fixnum_sp>(cl::_sym_STARread_baseSTAR->symbolValue()));
+  claspCharacter x, y, z;
+  ReadTableSyntax x_syntax_type;
 /* See the CLHS 2.2 Reader Algorithm  - continue has the effect of jumping to step 1 */
 step1:
   LOG_READ(BF("step1"));
-  SourcePosInfo_sp xxxsp;
-  T_sp tx = cl__read_char(sin, _Nil<T_O>(), _Nil<T_O>(), _lisp->_true());
-  if (tx.nilp()) {
+  x = input.read();
+  if (x == EOF) {
     if (eofErrorP)
       STREAM_ERROR(sin);
     return Values(eofValue);
   }
-  xxx = gc::As<Character_sp>(tx);
-  LOG_READ(BF("Read character x[%d/%s]") % (int)clasp_as_claspCharacter(xxx) % (char)clasp_as_claspCharacter(xxx));
-  Symbol_sp xxx_syntax_type = readTable->syntax_type(xxx);
+  LOG_READ(BF("Read character x[%d/%s]") % (int)x % (char)x);
+  x_syntax_type = readTable->syntax_code(x);
   //    step2:
-  if (xxx_syntax_type == kw::_sym_invalid) {
-    LOG_READ(BF("step2 - invalid-character[%c]") % clasp_as_claspCharacter(xxx));
+  if (x_syntax_type == syntax_invalid) {
+    LOG_READ(BF("step2 - invalid-character[%c]") % x);
     SIMPLE_ERROR(BF("ReaderError_O::create(sin,_lisp)"));
   }
   //    step3:
-  if (xxx_syntax_type == kw::_sym_whitespace) {
-    LOG_READ(BF("step3 - whitespace character[%c/%d]") % clasp_as_claspCharacter(xxx) % clasp_as_claspCharacter(xxx));
+  if (x_syntax_type == syntax_whitespace) {
+    LOG_READ(BF("step3 - whitespace character[%c/%d]") % x % x);
     goto step1;
   }
   //    step4:
-  if ((xxx_syntax_type == kw::_sym_terminating_macro) || (xxx_syntax_type == kw::_sym_non_terminating_macro)) {
-    _BLOCK_TRACEF(BF("Processing macro character x[%s]") % clasp_as_claspCharacter(xxx));
-    LOG_READ(BF("step4 - terminating-macro-character or non-terminating-macro-character char[%c]") % clasp_as_claspCharacter(xxx));
+  if ((x_syntax_type == syntax_terminating_macro) || (x_syntax_type == syntax_non_terminating_macro)) {
+    _BLOCK_TRACEF(BF("Processing macro character x[%s]") % x);
+    LOG_READ(BF("step4 - terminating-macro-character or non-terminating-macro-character char[%c]") % x);
+    Character_sp xxx = clasp_make_character(x);
     T_sp reader_macro;
-    reader_macro = readTable->get_macro_character(xxx);
+    reader_macro = readTable->macro_function(x);
     ASSERT(reader_macro.notnilp());
     if (gc::IsA<Symbol_sp>(reader_macro)) {
       // At startup symbols that define reader macro functions aren't fbound yet
       // We need to read the lambda lists somehow - so hard code the reader macro calls
       Symbol_sp sreader_macro = gc::As_unsafe<Symbol_sp>(reader_macro);
       if (!sreader_macro->fboundp()) {
-        if (clasp_as_claspCharacter(xxx) == '(') {
+        if (x == '(') {
           return core__reader_list_allow_consing_dot(sin,xxx);
-        } else if (clasp_as_claspCharacter(xxx) == '"') {
+        } else if (x == '"') {
           return core__reader_double_quote_string(sin,xxx);
-        } else if (clasp_as_claspCharacter(xxx) == '\'') {
+        } else if (x == '\'') {
           return core__reader_quote(sin,xxx);
         }
-        printf("%s:%d Handle character '%c' in lisp_object_query\n", __FILE__, __LINE__, clasp_as_claspCharacter(xxx));
+        printf("%s:%d Handle character '%c' in lisp_object_query\n", __FILE__, __LINE__, x);
       }
     }
     T_mv results = eval::funcall(reader_macro, sin, xxx);
@@ -1131,22 +1129,21 @@ step1:
     return object;
   }
   //    step5:
-  if (xxx_syntax_type == kw::_sym_single_escape) {
-    LOG_READ(BF("step5 - single-escape-character char[%c]") % clasp_as_claspCharacter(xxx));
+  if (x_syntax_type == syntax_single_escape) {
+    LOG_READ(BF("step5 - single-escape-character char[%c]") % x);
     LOG_READ(BF("Handling single escape"));
-    T_sp ty = cl__read_char(sin, _lisp->_true(), _Nil<T_O>(), _lisp->_true());
-    if ( !ty.characterp() ) {
+    y = input.read();
+    if (y == EOF) {
       SIMPLE_ERROR(BF("Expected character - hit end"));
     }
-    y = gc::As<Character_sp>(ty);
     token.clear();
-    token.push_back(constituentChar(y, TRAIT_ALPHABETIC));
-    LOG_READ(BF("Read y[%d/%s]") % (int)clasp_as_claspCharacter(y) % clasp_as_claspCharacter(y));
+    token.push_back(escapedChar(y));
+    LOG_READ(BF("Read y[%d/%s]") % (int)y % y);
     goto step8;
   }
   //    step6:
-  if (xxx_syntax_type == kw::_sym_multiple_escape) {
-    LOG_READ(BF("step6 - multiple-escape-character char[%c]") % clasp_as_claspCharacter(xxx));
+  if (x_syntax_type == syntax_multiple_escape) {
+    LOG_READ(BF("step6 - multiple-escape-character char[%c]") % x);
     LOG_READ(BF("Handling multiple escape - clearing token"));
     token.clear();
       // |....| or ....|| or ..|.|.. is ok
@@ -1154,59 +1151,56 @@ step1:
     goto step9;
   }
   //    step7:
-  if ( xxx_syntax_type /*readTable->syntax_type(xxx)*/ == kw::_sym_constituent) {
-    LOG_READ(BF("step7 - Handling constituent-character char[%s]") % _rep_(xxx));
+  if ( x_syntax_type == syntax_constituent) {
+    LOG_READ(BF("step7 - Handling constituent-character char[%c]") % x);
     token.clear();
-    // X = readTable->convert_case(x);
-    X = xxx; // convert case once the entire token is accumulated
-    token.push_back(constituentChar(X));
+    // convert case once the entire token is accumulated
+    token.push_back(constituentChar(x, read_base));
   }
 step8:
   LOG_READ(BF("step8"));
   {
-    T_sp ty = cl__read_char(sin, _Nil<T_O>(), _Nil<T_O>(), _lisp->_true());
-    if (ty.nilp()) {
+    y = input.read();
+    if (y == EOF) {
       LOG_READ(BF("Hit eof"));
       goto step10;
     }
-    Character_sp y(gc::As_unsafe<Character_sp>(ty));
-    LOG_READ(BF("Step8: Read y[%s/%c]") % clasp_as_claspCharacter(y) % (char)clasp_as_claspCharacter(y));
-    Symbol_sp y8_syntax_type = readTable->syntax_type(y);
-    LOG_READ(BF("y8_syntax_type=%s") % _rep_(y8_syntax_type));
-    if ((y8_syntax_type == kw::_sym_constituent) || (y8_syntax_type == kw::_sym_non_terminating_macro)) {
-      // Y = readTable->convert_case(y);
-      Y = y;  // convert case once the entire token is accumulated
-      LOG_READ(BF("  Pushing back character %d") % constituentChar(Y));
-      token.push_back(constituentChar(Y));
+    LOG_READ(BF("Step8: Read y[%s/%c]") % y % (char)y);
+    ReadTableSyntax y8_syntax_type = readTable->syntax_code(y);
+    LOG_READ(BF("y8_syntax_type=%d") % y8_syntax_type);
+    if ((y8_syntax_type == syntax_constituent) || (y8_syntax_type == syntax_non_terminating_macro)) {
+      // convert case once the entire token is accumulated
+      LOG_READ(BF("  Pushing back character %d") % constituentChar(y, read_base));
+      token.push_back(constituentChar(y, read_base));
       goto step8;
     }
-    if (y8_syntax_type == kw::_sym_single_escape) {
-      z = gc::As<Character_sp>(cl__read_char(sin, _lisp->_true(), _Nil<T_O>(), _lisp->_true()));
-      token.push_back(constituentChar(z, TRAIT_ALPHABETIC|TRAIT_ESCAPED));
-      LOG_READ(BF("Single escape read z[%s] accumulated token[%s]") % clasp_as_claspCharacter(z) % tokenStr(sin,token));
+    if (y8_syntax_type == syntax_single_escape) {
+      z = input.read_or_die();
+      token.push_back(escapedChar(z));
+      LOG_READ(BF("Single escape read z[%s] accumulated token[%s]") % z % tokenStr(sin,token));
       goto step8;
     }
-    if (y8_syntax_type == kw::_sym_multiple_escape) {
+    if (y8_syntax_type == syntax_multiple_escape) {
       // |....| or ....|| or ..|.|.. is ok
       only_dots_ok = true;
       goto step9;
     }
-    if (y8_syntax_type == kw::_sym_invalid)
+    if (y8_syntax_type == syntax_invalid)
       SIMPLE_ERROR(BF("ReaderError_O::create()"));
-    if (y8_syntax_type == kw::_sym_terminating_macro) {
-      LOG_READ(BF("UNREADING char y[%s]") % clasp_as_claspCharacter(y));
-      clasp_unread_char(clasp_as_claspCharacter(y), sin);
+    if (y8_syntax_type == syntax_terminating_macro) {
+      LOG_READ(BF("UNREADING char y[%s]") % y);
+      input.unread(y);
       goto step10;
     }
-    if (y8_syntax_type == kw::_sym_whitespace) {
+    if (y8_syntax_type == syntax_whitespace) {
       LOG_READ(BF("y is whitespace"));
 #if 0
       if (_sym_STARpreserve_whitespace_pSTAR->symbolValue().isTrue()) { // Can this be recursiveP?
-        LOG_READ(BF("unreading y[%s]") % clasp_as_claspCharacter(y));
-        clasp_unread_char(clasp_as_claspCharacter(y), sin);
+        LOG_READ(BF("unreading y[%s]") % y);
+        input.unread(y);
       }
 #else
-      clasp_unread_char(clasp_as_claspCharacter(y), sin);
+      input.unread(y);
 #endif
       goto step10;
     }
@@ -1214,29 +1208,29 @@ step8:
 step9:
   LOG_READ(BF("step9"));
   {
-    y = gc::As<Character_sp>(cl__read_char(sin, _lisp->_true(), _Nil<T_O>(), _lisp->_true()));
-    Symbol_sp y9_syntax_type = readTable->syntax_type(y);
-    LOG_READ(BF("Step9: Read y[%s] y9_syntax_type[%s]") % clasp_as_claspCharacter(y) % _rep_(y9_syntax_type));
-    if ((y9_syntax_type == kw::_sym_constituent) || (y9_syntax_type == kw::_sym_non_terminating_macro) || (y9_syntax_type == kw::_sym_terminating_macro) || (y9_syntax_type == kw::_sym_whitespace)) {
-      token.push_back(constituentChar(y, TRAIT_ALPHABETIC|TRAIT_ESCAPED));
+    y = input.read_or_die();
+    ReadTableSyntax y9_syntax_type = readTable->syntax_code(y);
+    LOG_READ(BF("Step9: Read y[%s] y9_syntax_type[%d]") % y % y9_syntax_type);
+    if ((y9_syntax_type == syntax_constituent) || (y9_syntax_type == syntax_non_terminating_macro) || (y9_syntax_type == syntax_terminating_macro) || (y9_syntax_type == syntax_whitespace)) {
+      token.push_back(escapedChar(y));
       LOG_READ(BF("token[%s]") % tokenStr(sin,token));
       goto step9;
     }
-    LOG_READ(BF("About to test y9_syntax_type[%s] single_escape[%s] are equal? ==> %d") % _rep_(y9_syntax_type) % _rep_(kw::_sym_single_escape) % (y9_syntax_type == kw::_sym_single_escape));
-    if (y9_syntax_type == kw::_sym_single_escape) {
+    LOG_READ(BF("About to test y9_syntax_type[%d] single_escape[%d] are equal? ==> %d") % y9_syntax_type % syntax_single_escape % (y9_syntax_type == syntax_single_escape));
+    if (y9_syntax_type == syntax_single_escape) {
       LOG_READ(BF("Handling single_escape_character"));
-      z = gc::As<Character_sp>(cl__read_char(sin, _lisp->_true(), _Nil<T_O>(), _lisp->_true()));
-      token.push_back(constituentChar(z, TRAIT_ALPHABETIC|TRAIT_ESCAPED));
-      LOG_READ(BF("Read z[%s] accumulated token[%s]") % clasp_as_claspCharacter(z) % tokenStr(sin,token));
+      z = input.read_or_die();
+      token.push_back(escapedChar(z));
+      LOG_READ(BF("Read z[%s] accumulated token[%s]") % z % tokenStr(sin,token));
       goto step9;
     }
-    if (y9_syntax_type == kw::_sym_multiple_escape) {
+    if (y9_syntax_type == syntax_multiple_escape) {
       LOG_READ(BF("Handling multiple_escape_character"));
       // |....| or ....|| or ..|.|.. is ok
       only_dots_ok = true;
       goto step8;
     }
-    if (y9_syntax_type == kw::_sym_invalid) {
+    if (y9_syntax_type == syntax_invalid) {
       SIMPLE_ERROR(BF("ReaderError_O::create()"));
     }
     SIMPLE_ERROR(BF("Should never get here"));
@@ -47,6 +47,9 @@ THE SOFTWARE.
 #include <stdio.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include <clasp/core/foundation.h>
 #include <clasp/core/common.h>
 #include <clasp/core/fileSystem.h>
@@ -340,6 +343,18 @@ const FileOps &duplicate_dispatch_table(const FileOps &ops);
 const FileOps &stream_dispatch_table(T_sp strm);
 
 static int flisten(T_sp, FILE *);
+static bool io_file_unread_bytes(T_sp strm, const unsigned char *c, cl_index n);
+
+enum BulkFormat { bulk_none,
+                  bulk_latin_1,
+                  bulk_ascii,
+                  bulk_utf_8 };
+
+static BulkFormat bulk_format_for(T_sp strm, bool input);
+static bool bulk_string_p(T_sp data);
+static cl_index bulk_read_string(T_sp strm, BulkFormat fmt, AbstractSimpleVector_sp sv, cl_index start, cl_index end);
+static void bulk_write_string(T_sp strm, BulkFormat fmt, Array_sp data, cl_index start, cl_index end);
+static int io_file_read_line(T_sp strm, T_sp &line, bool &missing_newline);
 static int file_listen(T_sp, int);
 
 //    static T_sp alloc_stream();
@@ -720,6 +735,13 @@ static cl_index
 generic_write_vector(T_sp strm, T_sp data, cl_index start, cl_index end) {
   if (start >= end)
     return start;
+  if (bulk_string_p(data)) {
+    BulkFormat fmt = bulk_format_for(strm, false);
+    if (fmt != bulk_none) {
+      bulk_write_string(strm, fmt, gc::As_unsafe<Array_sp>(data), start, end);
+      return end;
+    }
+  }
   const FileOps &ops = stream_dispatch_table(strm);
   Vector_sp vec = gc::As<Vector_sp>(data);
   T_sp elementType = vec->arrayElementType();
@@ -766,6 +788,15 @@ generic_read_vector(T_sp strm, T_sp data, cl_index start, cl_index end) {
   const FileOps &ops = stream_dispatch_table(strm);
   T_sp expected_type = clasp_stream_element_type(strm);
   if (expected_type == cl::_sym_base_char || expected_type == cl::_sym_character) {
+    if (bulk_string_p(data)) {
+      BulkFormat fmt = bulk_format_for(strm, true);
+      if (fmt != bulk_none) {
+        AbstractSimpleVector_sp sv;
+        size_t vstart, vend;
+        vec->asAbstractSimpleVectorRange(sv, vstart, vend);
+        return bulk_read_string(strm, fmt, sv, vstart + start, vstart + end) - vstart;
+      }
+    }
     claspCharacter (*read_char)(T_sp) = ops.read_char;
     for (; start < end; start++) {
       claspCharacter c = read_char(strm);
@@ -805,10 +836,13 @@ eformat_unread_char(T_sp strm, claspCharacter c) {
     if (i != EOF) {
       ndx += StreamEncoder(strm)(strm, buffer + ndx, i);
     }
+    /* A buffered file stream can usually just step back in its buffer */
+    if (l.nilp() && io_file_unread_bytes(strm, buffer, ndx))
+      ndx = 0;
     while (ndx != 0) {
       l = Cons_O::create(make_fixnum(buffer[--ndx]), l);
     }
-    StreamByteStack(strm) = gc::As<Cons_sp>(l);
+    StreamByteStack(strm) = l;
     StreamLastChar(strm) = EOF;
     StreamInputCursor(strm).backup(strm, c);
   }
@@ -839,6 +873,15 @@ eformat_read_char(T_sp strm) {
   return c;
 }
 
+/* Streams on the C stdout FILE share its buffer with printf, flush it so
+ * the output stays in order.  Other streams don't pay for a flush. */
+static inline void
+flush_if_c_stdout(T_sp strm) {
+  int mode = StreamMode(strm);
+  if ((mode == clasp_smm_output || mode == clasp_smm_io) && IOStreamStreamFile(strm) == stdout)
+    fflush(stdout);
+}
+
 static claspCharacter
 eformat_write_char(T_sp strm, claspCharacter c) {
   unsigned char buffer[ENCODING_BUFFER_MAX_SIZE];
@@ -851,7 +894,7 @@ eformat_write_char(T_sp strm, claspCharacter c) {
     StreamOutputColumn(strm) = (StreamOutputColumn(strm) & ~((cl_index)07)) + 8;
   else
     StreamOutputColumn(strm)++;
-  fflush(stdout);
+  flush_if_c_stdout(strm);
   return c;
 }
 
@@ -1378,6 +1421,296 @@ utf_8_encoder(T_sp stream, unsigned char *buffer, claspCharacter c) {
 }
 #endif
 
+/**********************************************************************
+ * BULK ENCODING AND DECODING
+ *
+ * LATIN-1, US-ASCII and UTF-8 streams without newline translation move
+ * whole runs of characters through a local byte buffer.  read-sequence,
+ * write-sequence, write-string and read-line use these instead of
+ * calling the decoder/encoder and read_byte8/write_byte8 per character.
+ */
+
+#define BULK_BUFFER_SIZE 4096
+
+static BulkFormat
+bulk_format_for(T_sp strm, bool input) {
+  if (!AnsiStreamP(strm) || StreamEofChar(strm) != EOF)
+    return bulk_none;
+  if (input) {
+    if (StreamOps(strm).read_char != eformat_read_char)
+      return bulk_none;
+    cl_eformat_decoder decoder = StreamDecoder(strm);
+    if (decoder == passthrough_decoder)
+      return bulk_latin_1;
+#ifdef CLASP_UNICODE
+    if (decoder == ascii_decoder)
+      return bulk_ascii;
+    if (decoder == utf_8_decoder)
+      return bulk_utf_8;
+#endif
+  } else {
+    if (StreamOps(strm).write_char != eformat_write_char)
+      return bulk_none;
+    cl_eformat_encoder encoder = StreamEncoder(strm);
+    if (encoder == passthrough_encoder)
+      return bulk_latin_1;
+#ifdef CLASP_UNICODE
+    if (encoder == ascii_encoder)
+      return bulk_ascii;
+    if (encoder == utf_8_encoder)
+      return bulk_utf_8;
+#endif
+  }
+  return bulk_none;
+}
+
+/* Number of leading bytes of S that are 7-bit ASCII */
+static inline size_t
+bulk_ascii_run_length(const unsigned char *s, size_t n) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+    if (_mm_movemask_epi8(v))
+      break;
+  }
+#endif
+  for (; i + 8 <= n; i += 8) {
+    uint64_t w;
+    memcpy(&w, s + i, 8);
+    if (w & 0x8080808080808080ULL)
+      break;
+  }
+  while (i < n && s[i] < 0x80)
+    ++i;
+  return i;
+}
+
+/* First #\Newline or #\Return byte in [S,E) or NULL.  Neither byte can
+ * appear inside a UTF-8 multibyte sequence so this works for all bulk formats. */
+static inline const unsigned char *
+bulk_find_line_end(const unsigned char *s, const unsigned char *e) {
+#if defined(__SSE2__)
+  const __m128i nl = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+  for (; s + 16 <= e; s += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+    int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, nl), _mm_cmpeq_epi8(v, cr)));
+    if (mask)
+      return s + __builtin_ctz(mask);
+  }
+#endif
+  for (; s < e; ++s) {
+    if (*s == '\n' || *s == '\r')
+      return s;
+  }
+  return NULL;
+}
+
+/* Length of the UTF-8 sequence introduced by LEAD, or 1 for bytes
+ * that the decoder will reject anyway. */
+static inline int
+bulk_utf_8_sequence_length(unsigned char lead) {
+  if ((lead & 0x80) == 0 || (lead & 0x40) == 0)
+    return 1;
+  if ((lead & 0x20) == 0)
+    return 2;
+  if ((lead & 0x10) == 0)
+    return 3;
+  if ((lead & 0x08) == 0)
+    return 4;
+  return 1;
+}
+
+/* Decode one character starting at P, which must hold a complete sequence.
+ * Mirrors utf_8_decoder including its error reporting. */
+static claspCharacter
+bulk_utf_8_decode_one(T_sp strm, const unsigned char *&p) {
+  unsigned char buffer[5];
+  int nbytes = bulk_utf_8_sequence_length(p[0]) - 1;
+  buffer[0] = *p++;
+  if ((buffer[0] & 0x80) == 0)
+    return buffer[0];
+  unlikely_if(nbytes == 0) return ext__decoding_error(strm, buffer, 1);
+  claspCharacter cum = buffer[0] & (0x3F >> nbytes);
+  for (int i = 1; i <= nbytes; i++) {
+    unsigned char c = buffer[i] = *p++;
+    unlikely_if((c & 0xC0) != 0x80) return ext__decoding_error(strm, buffer, nbytes + 1);
+    cum = (cum << 6) | (c & 0x3F);
+    unlikely_if(cum == 0) return ext__decoding_error(strm, buffer, nbytes + 1);
+  }
+  if (cum >= 0xd800) {
+    unlikely_if(cum <= 0xdfff) return ext__decoding_error(strm, buffer, nbytes + 1);
+    unlikely_if(cum >= 0xFFFE && cum <= 0xFFFF) return ext__decoding_error(strm, buffer, nbytes + 1);
+  }
+  return cum;
+}
+
+/* Decode the complete sequences in [P,E) calling STORE for every character.
+ * Returns the number of bytes consumed, which is less than E-P only when a
+ * UTF-8 sequence is cut off at the end. */
+template <typename Store>
+static size_t
+bulk_decode(T_sp strm, BulkFormat fmt, const unsigned char *p, const unsigned char *e, Store store) {
+  const unsigned char *start = p;
+  while (p < e) {
+    size_t run = (fmt == bulk_latin_1) ? (e - p) : bulk_ascii_run_length(p, e - p);
+    for (const unsigned char *r = p + run; p < r; ++p)
+      store((claspCharacter)*p);
+    if (p == e)
+      break;
+    if (fmt == bulk_ascii) {
+      unsigned char aux = *p++;
+      store(ext__decoding_error(strm, &aux, 1));
+    } else {
+      if (p + bulk_utf_8_sequence_length(*p) > e)
+        break;
+      store(bulk_utf_8_decode_one(strm, p));
+    }
+  }
+  return p - start;
+}
+
+/* Make a fresh simple string out of N encoded bytes.  It is a
+ * SimpleBaseString unless some character is not a base-char. */
+static String_sp
+bulk_decode_to_string(T_sp strm, BulkFormat fmt, const unsigned char *bytes, size_t n) {
+  if (fmt == bulk_latin_1 || bulk_ascii_run_length(bytes, n) == n) {
+    return SimpleBaseString_O::make(n, '\0', true, n, (const claspChar *)bytes);
+  }
+  std::vector<claspCharacter> chars;
+  chars.reserve(n);
+  bool base = true;
+  bulk_decode(strm, fmt, bytes, bytes + n, [&chars, &base](claspCharacter c) {
+      base = base && clasp_base_char_p(c);
+      chars.push_back(c);
+    });
+  if (base) {
+    SimpleBaseString_sp result = SimpleBaseString_O::make(chars.size());
+    for (size_t i = 0; i < chars.size(); ++i)
+      (*result)[i] = chars[i];
+    return result;
+  }
+  return SimpleCharacterString_O::make(chars.size(), '\0', true, chars.size(), chars.data());
+}
+
+/* Remember the last character read so that unread-char works and keep
+ * the input cursor up to date, as eformat_read_char would have. */
+static inline void
+bulk_note_char_read(T_sp strm, claspCharacter c) {
+  StreamLastChar(strm) = c;
+  StreamLastCode(strm, 0) = c;
+  StreamLastCode(strm, 1) = EOF;
+  StreamInputCursor(strm).advanceForChar(strm, c, c);
+}
+
+/* Read characters into [start,end) of the simple string SV.
+ * Returns the index after the last character stored. */
+static cl_index
+bulk_read_string(T_sp strm, BulkFormat fmt, AbstractSimpleVector_sp sv, cl_index start, cl_index end) {
+  unsigned char buffer[BULK_BUFFER_SIZE];
+  SimpleBaseString_sp sbs = sv.asOrNull<SimpleBaseString_O>();
+  SimpleCharacterString_sp scs = sv.asOrNull<SimpleCharacterString_O>();
+  cl_index index = start;
+  auto store = [&](claspCharacter c) {
+    if (scs)
+      (*scs)[index] = c;
+    else if (clasp_base_char_p(c))
+      (*sbs)[index] = c;
+    else
+      sv->rowMajorAset(index, clasp_make_character(c)); // signals the type error
+    bulk_note_char_read(strm, c);
+    index++;
+  };
+  while (index < end) {
+    /* Every character takes at least one byte so this never reads too far */
+    cl_index want = MIN(end - index, (cl_index)(BULK_BUFFER_SIZE - 4));
+    cl_index chunk = clasp_read_byte8(strm, buffer, want);
+    if (chunk == 0)
+      break;
+    cl_index got = chunk;
+    if (fmt == bulk_utf_8) {
+      /* Complete a sequence that was cut off at the end of the chunk */
+      cl_index lead = got;
+      while (lead > 0 && got - lead < 4 && (buffer[lead - 1] & 0xC0) == 0x80)
+        --lead;
+      if (lead > 0) {
+        cl_index need = bulk_utf_8_sequence_length(buffer[lead - 1]);
+        if (got - (lead - 1) < need)
+          got += clasp_read_byte8(strm, buffer + got, need - (got - (lead - 1)));
+      }
+    }
+    cl_index used = bulk_decode(strm, fmt, buffer, buffer + got, store);
+    if (used < got)
+      break; // EOF in the middle of a character
+    /* A short chunk is not EOF on pipes and terminals, only a read of 0 bytes is */
+  }
+  return index;
+}
+
+/* Encode N characters and hand them to write_byte8 in large chunks.
+ * The output column is tracked exactly as eformat_write_char does. */
+template <typename CharType>
+static void
+bulk_write_chars(T_sp strm, BulkFormat fmt, const CharType *chars, cl_index n) {
+  unsigned char buffer[BULK_BUFFER_SIZE];
+  cl_index (*write_byte8)(T_sp, unsigned char *, cl_index) = StreamOps(strm).write_byte8;
+  int column = StreamOutputColumn(strm);
+  cl_index fill = 0;
+  for (cl_index i = 0; i < n; ++i) {
+    claspCharacter c = (claspCharacter)chars[i];
+    if (fill > BULK_BUFFER_SIZE - ENCODING_BUFFER_MAX_SIZE) {
+      write_byte8(strm, buffer, fill);
+      fill = 0;
+    }
+    if (c < 0x80) {
+      buffer[fill++] = c;
+    } else if (fmt == bulk_latin_1) {
+      fill += passthrough_encoder(strm, buffer + fill, c);
+#ifdef CLASP_UNICODE
+    } else if (fmt == bulk_utf_8) {
+      fill += utf_8_encoder(strm, buffer + fill, c);
+    } else {
+      fill += ascii_encoder(strm, buffer + fill, c);
+#endif
+    }
+    if (c == '\n')
+      column = 0;
+    else if (c == '\t')
+      column = (column & ~((cl_index)07)) + 8;
+    else
+      column++;
+  }
+  if (fill)
+    write_byte8(strm, buffer, fill);
+  StreamOutputColumn(strm) = column;
+  flush_if_c_stdout(strm);
+}
+
+/* Write [start,end) of a string through the bulk encoder */
+static void
+bulk_write_string(T_sp strm, BulkFormat fmt, Array_sp data, cl_index start, cl_index end) {
+  AbstractSimpleVector_sp sv;
+  size_t vstart, vend;
+  data->asAbstractSimpleVectorRange(sv, vstart, vend);
+  if (SimpleBaseString_sp sbs = sv.asOrNull<SimpleBaseString_O>()) {
+    bulk_write_chars(strm, fmt, &(*sbs)[vstart + start], end - start);
+  } else {
+    SimpleCharacterString_sp scs = gc::As_unsafe<SimpleCharacterString_sp>(sv);
+    bulk_write_chars(strm, fmt, &(*scs)[vstart + start], end - start);
+  }
+}
+
+static bool
+bulk_string_p(T_sp data) {
+  clasp_elttype elttype = clasp_array_elttype(data);
+  return elttype == clasp_aet_bc
+#ifdef CLASP_UNICODE
+         || elttype == clasp_aet_ch
+#endif
+      ;
+}
+
 /********************************************************************************
  * CLOS STREAMS
  */
@@ -2802,25 +3135,27 @@ consume_byte_stack(T_sp strm, unsigned char *c, cl_index n) {
   return out;
 }
 
+/*
+ * The descriptor is only touched through io_file_read_raw and
+ * io_file_write_raw.  Everything above them goes through the user-space
+ * buffers of the IOFileStream_O so that reading or writing a character
+ * costs a memcpy and not a system call.
+ */
+
 static cl_index
-io_file_read_byte8(T_sp strm, unsigned char *c, cl_index n) {
-  unlikely_if(StreamByteStack(strm).notnilp()) { // != _Nil<T_O>()) {
-    return consume_byte_stack(strm, c, n);
-  }
-  else {
-    int f = IOFileStreamDescriptor(strm);
-    gctools::Fixnum out = 0;
-    clasp_disable_interrupts();
-    do {
-      out = read(f, c, sizeof(char) * n);
-    } while (out < 0 && restartable_io_error(strm, "read"));
-    clasp_enable_interrupts();
-    return out;
-  }
+io_file_read_raw(T_sp strm, unsigned char *c, cl_index n) {
+  int f = IOFileStreamDescriptor(strm);
+  gctools::Fixnum out = 0;
+  clasp_disable_interrupts();
+  do {
+    out = read(f, c, sizeof(char) * n);
+  } while (out < 0 && restartable_io_error(strm, "read"));
+  clasp_enable_interrupts();
+  return out;
 }
 
 static cl_index
-output_file_write_byte8(T_sp strm, unsigned char *c, cl_index n) {
+io_file_write_raw(T_sp strm, unsigned char *c, cl_index n) {
   int f = IOFileStreamDescriptor(strm);
   gctools::Fixnum out;
   clasp_disable_interrupts();
@@ -2831,6 +3166,104 @@ output_file_write_byte8(T_sp strm, unsigned char *c, cl_index n) {
   return out;
 }
 
+/* Hand all pending output to the kernel */
+static void
+io_file_flush_output(T_sp strm) {
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  cl_index done = 0;
+  while (done < fs->_OutputFill) {
+    cl_index out = io_file_write_raw(strm, fs->_OutputBuffer + done, fs->_OutputFill - done);
+    if (out == 0)
+      break;
+    done += out;
+  }
+  fs->_OutputFill = 0;
+}
+
+/* Throw away any buffered input.  If the descriptor is seekable move it
+ * back so that it points at the first byte that lisp has not consumed. */
+static void
+io_file_discard_input(T_sp strm) {
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  cl_index pending = fs->_InputEnd - fs->_InputStart;
+  if (pending && (StreamFlags(strm) & CLASP_STREAM_MIGHT_SEEK)) {
+    clasp_disable_interrupts();
+    lseek(IOFileStreamDescriptor(strm), -(clasp_off_t)pending, SEEK_CUR);
+    clasp_enable_interrupts();
+  }
+  fs->_InputStart = fs->_InputEnd = 0;
+}
+
+/* Give back the n bytes that were just consumed from the input buffer.
+ * Used by unread-char so that peeking does not cons up a byte stack. */
+static bool
+io_file_unread_bytes(T_sp strm, const unsigned char *c, cl_index n) {
+  if (StreamMode(strm) != clasp_smm_input_file && StreamMode(strm) != clasp_smm_io_file)
+    return false;
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  if (fs->_InputBuffer == NULL || fs->_InputStart < n)
+    return false;
+  if (memcmp(fs->_InputBuffer + fs->_InputStart - n, c, n) != 0)
+    return false;
+  fs->_InputStart -= n;
+  return true;
+}
+
+static cl_index
+io_file_read_byte8(T_sp strm, unsigned char *c, cl_index n) {
+  unlikely_if(StreamByteStack(strm).notnilp()) { // != _Nil<T_O>()) {
+    return consume_byte_stack(strm, c, n);
+  }
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  unlikely_if(fs->_OutputFill) io_file_flush_output(strm);
+  if (fs->_InputBuffer == NULL) {
+    return io_file_read_raw(strm, c, n);
+  }
+  cl_index out = 0;
+  while (n) {
+    cl_index avail = fs->_InputEnd - fs->_InputStart;
+    if (avail == 0) {
+      if (n >= fs->_BufferSize) {
+        /* Large reads go straight into the caller's memory */
+        cl_index got = io_file_read_raw(strm, c, n);
+        if (got == 0)
+          break;
+        c += got;
+        n -= got;
+        out += got;
+        continue;
+      }
+      fs->_InputStart = 0;
+      fs->_InputEnd = avail = io_file_read_raw(strm, fs->_InputBuffer, fs->_BufferSize);
+      if (avail == 0)
+        break;
+    }
+    cl_index chunk = (n < avail) ? n : avail;
+    memcpy(c, fs->_InputBuffer + fs->_InputStart, chunk);
+    fs->_InputStart += chunk;
+    c += chunk;
+    n -= chunk;
+    out += chunk;
+  }
+  return out;
+}
+
+static cl_index
+output_file_write_byte8(T_sp strm, unsigned char *c, cl_index n) {
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  if (fs->_OutputBuffer == NULL) {
+    return io_file_write_raw(strm, c, n);
+  }
+  if (fs->_OutputFill + n > fs->_BufferSize) {
+    io_file_flush_output(strm);
+    if (n >= fs->_BufferSize)
+      return io_file_write_raw(strm, c, n);
+  }
+  memcpy(fs->_OutputBuffer + fs->_OutputFill, c, n);
+  fs->_OutputFill += n;
+  return n;
+}
+
 static cl_index
 io_file_write_byte8(T_sp strm, unsigned char *c, cl_index n) {
   unlikely_if(StreamByteStack(strm).notnilp()) { // != _Nil<T_O>()) {
@@ -2840,6 +3273,13 @@ io_file_write_byte8(T_sp strm, unsigned char *c, cl_index n) {
       clasp_file_position_set(strm, aux);
     StreamByteStack(strm) = _Nil<T_O>();
   }
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  unlikely_if(fs->_InputEnd != fs->_InputStart) {
+    /* Only a seekable file shares one position between reading and
+     * writing - sockets and pipes keep their input */
+    if (StreamFlags(strm) & CLASP_STREAM_MIGHT_SEEK)
+      io_file_discard_input(strm);
+  }
   return output_file_write_byte8(strm, c, n);
 }
 
@@ -2847,6 +3287,9 @@ static int
 io_file_listen(T_sp strm) {
   if (StreamByteStack(strm).notnilp()) // != _Nil<T_O>())
     return CLASP_LISTEN_AVAILABLE;
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  if (fs->_InputEnd != fs->_InputStart)
+    return CLASP_LISTEN_AVAILABLE;
   if (StreamFlags(strm) & CLASP_STREAM_MIGHT_SEEK) {
     cl_env_ptr the_env = clasp_process_env();
     int f = IOFileStreamDescriptor(strm);
@@ -2869,6 +3312,100 @@ io_file_listen(T_sp strm) {
   return file_listen(strm, IOFileStreamDescriptor(strm));
 }
 
+/* (Re)allocate the user-space buffers.  A size of 0 makes the stream unbuffered. */
+static void
+io_file_set_buffer_size(T_sp strm, cl_index buffer_size) {
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  if (fs->_OutputFill) io_file_flush_output(strm);
+  io_file_discard_input(strm);
+  gctools::clasp_dealloc(StreamBuffer(strm));
+  StreamBuffer(strm) = NULL;
+  fs->_InputBuffer = fs->_OutputBuffer = NULL;
+  fs->_BufferSize = buffer_size;
+  if (buffer_size == 0)
+    return;
+  bool input = clasp_input_stream_p(strm);
+  bool output = clasp_output_stream_p(strm);
+  char *buffer = gctools::clasp_alloc_atomic(buffer_size * ((input ? 1 : 0) + (output ? 1 : 0)));
+  StreamBuffer(strm) = buffer;
+  if (input) {
+    fs->_InputBuffer = reinterpret_cast<unsigned char *>(buffer);
+    buffer += buffer_size;
+  }
+  if (output) {
+    fs->_OutputBuffer = reinterpret_cast<unsigned char *>(buffer);
+  }
+}
+
+/* read-line straight out of the input buffer.  Returns -1 when the stream
+ * can't take this path, 0 at end of file and 1 when LINE was read. */
+static int
+io_file_read_line(T_sp strm, T_sp &line, bool &missing_newline) {
+  if (StreamMode(strm) != clasp_smm_input_file && StreamMode(strm) != clasp_smm_io_file)
+    return -1;
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  if (fs->_InputBuffer == NULL || StreamByteStack(strm).notnilp())
+    return -1;
+  BulkFormat fmt = bulk_format_for(strm, true);
+  if (fmt == bulk_none)
+    return -1;
+  unlikely_if(fs->_OutputFill) io_file_flush_output(strm);
+  std::string pending; // only used when a line spans several buffer fills
+  while (1) {
+    if (fs->_InputStart == fs->_InputEnd) {
+      fs->_InputStart = 0;
+      fs->_InputEnd = io_file_read_raw(strm, fs->_InputBuffer, fs->_BufferSize);
+      if (fs->_InputEnd == 0)
+        break;
+    }
+    const unsigned char *p = fs->_InputBuffer + fs->_InputStart;
+    const unsigned char *e = fs->_InputBuffer + fs->_InputEnd;
+    const unsigned char *eol = bulk_find_line_end(p, e);
+    if (eol == NULL) {
+      pending.append((const char *)p, e - p);
+      fs->_InputStart = fs->_InputEnd;
+      continue;
+    }
+    if (pending.empty()) {
+      line = bulk_decode_to_string(strm, fmt, p, eol - p);
+    } else {
+      pending.append((const char *)p, eol - p);
+      line = bulk_decode_to_string(strm, fmt, (const unsigned char *)pending.data(), pending.size());
+    }
+    fs->_InputStart = eol + 1 - fs->_InputBuffer;
+    claspCharacter terminator = *eol;
+    if (terminator == '\r') {
+      /* Like the character path, #\Return ends the line and swallows a #\Newline after it */
+      if (fs->_InputStart == fs->_InputEnd) {
+        fs->_InputStart = 0;
+        fs->_InputEnd = io_file_read_raw(strm, fs->_InputBuffer, fs->_BufferSize);
+      }
+      if (fs->_InputStart < fs->_InputEnd && fs->_InputBuffer[fs->_InputStart] == '\n') {
+        fs->_InputStart++;
+        terminator = '\n';
+      }
+    }
+    StreamLastChar(strm) = terminator;
+    StreamLastCode(strm, 0) = terminator;
+    StreamLastCode(strm, 1) = EOF;
+    StreamInputCursor(strm).advanceLineNumber(strm, terminator);
+    missing_newline = false;
+    return 1;
+  }
+  if (pending.empty())
+    return 0;
+  String_sp result = bulk_decode_to_string(strm, fmt, (const unsigned char *)pending.data(), pending.size());
+  if (result->length() > 0) {
+    claspCharacter last = result->rowMajorAref(result->length() - 1).unsafe_character();
+    StreamLastChar(strm) = last;
+    StreamLastCode(strm, 0) = last;
+    StreamLastCode(strm, 1) = EOF;
+  }
+  line = result;
+  missing_newline = true;
+  return 1;
+}
+
 #if defined(CLASP_MS_WINDOWS_HOST)
 static int
 isaconsole(int i) {
@@ -2890,15 +3427,29 @@ io_file_clear_input(T_sp strm) {
     /* Do not stop here: the FILE structure needs also to be flushed */
   }
 #endif
+  /* Whatever was already buffered counts as received input */
+  StreamByteStack(strm) = _Nil<T_O>();
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  fs->_InputStart = fs->_InputEnd = 0;
+  /* Drain the descriptor around the buffer - refilling the buffer would
+   * keep whatever the kernel had pending after one read */
+  unsigned char scratch[BUFSIZ];
   while (file_listen(strm, f) == CLASP_LISTEN_AVAILABLE) {
-    claspCharacter c = eformat_read_char(strm);
-    if (c == EOF)
+    if (io_file_read_raw(strm, scratch, sizeof(scratch)) == 0)
       return;
   }
 }
 
-#define io_file_clear_output generic_void
-#define io_file_force_output generic_void
+static void
+io_file_clear_output(T_sp strm) {
+  gc::As_unsafe<IOFileStream_sp>(strm)->_OutputFill = 0;
+}
+
+static void
+io_file_force_output(T_sp strm) {
+  io_file_flush_output(strm);
+}
+
 #define io_file_finish_output io_file_force_output
 
 static int
@@ -2915,6 +3466,7 @@ io_file_element_type(T_sp strm) {
 static T_sp
 io_file_length(T_sp strm) {
   int f = IOFileStreamDescriptor(strm);
+  io_file_flush_output(strm);
   T_sp output = clasp_file_len(f); // NIL or Integer_sp
   if (StreamByteSize(strm) != 8 && output.notnilp()) {
     cl_index bs = StreamByteSize(strm);
@@ -2938,6 +3490,11 @@ io_file_get_position(T_sp strm) {
   clasp_enable_interrupts();
   unlikely_if(offset < 0)
       io_error(strm);
+  {
+    /* The kernel's position is off by whatever sits in the buffers */
+    IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+    offset = offset - (clasp_off_t)(fs->_InputEnd - fs->_InputStart) + (clasp_off_t)fs->_OutputFill;
+  }
   if (sizeof(clasp_off_t) == sizeof(long)) {
     output = Integer_O::create((gctools::Fixnum)offset);
   } else {
@@ -2974,6 +3531,10 @@ io_file_set_position(T_sp strm, T_sp large_disp) {
     disp = clasp_integer_to_off_t(large_disp);
     mode = SEEK_SET;
   }
+  io_file_flush_output(strm);
+  IOFileStream_O *fs = gc::As_unsafe<IOFileStream_sp>(strm).get();
+  fs->_InputStart = fs->_InputEnd = 0;
+  StreamByteStack(strm) = _Nil<T_O>();
   disp = lseek(f, disp, mode);
   return (disp == (clasp_off_t)-1) ? _Nil<T_O>() : _lisp->_true();
 }
@@ -2991,6 +3552,7 @@ io_file_close(T_sp strm) {
       FEerror("Cannot close the standard output", 0);
   unlikely_if(f == STDIN_FILENO)
       FEerror("Cannot close the standard input", 0);
+  io_file_flush_output(strm);
   failed = safe_close(f);
   unlikely_if(failed < 0)
       cannot_close(strm);
@@ -3401,7 +3963,8 @@ void si_stream_external_format_set(T_sp stream, T_sp format) {
 }
 
 T_sp clasp_make_file_stream_from_fd(T_sp fname, int fd, enum StreamMode smm,
-                                    gctools::Fixnum byte_size, int flags, T_sp external_format) {
+                                    gctools::Fixnum byte_size, int flags, T_sp external_format,
+                                    cl_index buffer_size) {
   T_sp stream = IOFileStream_O::create();
   switch (smm) {
   case clasp_smm_input:
@@ -3430,6 +3993,10 @@ T_sp clasp_make_file_stream_from_fd(T_sp fname, int fd, enum StreamMode smm,
   StreamOutputColumn(stream) = 0;
   IOFileStreamDescriptor(stream) = fd;
   StreamLastOp(stream) = 0;
+  /* Output to a terminal must show up without an explicit force-output */
+  if (clasp_output_stream_p(stream) && isatty(fd))
+    buffer_size = 0;
+  io_file_set_buffer_size(stream, buffer_size);
   //	si_set_finalizer(stream, _lisp->_true());
   return stream;
 }
@@ -4123,11 +4690,11 @@ maybe_make_windows_console_fd(T_sp fname, int desc, StreamMode smm,
 #define maybe_make_windows_console_fd clasp_make_file_stream_from_fd
 #endif
 
-CL_LAMBDA(stream mode);
+CL_LAMBDA(stream mode &optional buffer-size);
 CL_DECLARE();
-CL_DOCSTRING("set-buffering-mode");
+CL_DOCSTRING("Set the buffering mode (:none, :line or :full) of a file stream. BUFFER-SIZE defaults to BUFSIZ for C streams and to the size used by OPEN for descriptor streams.");
 CL_DEFUN 
-T_sp core__set_buffering_mode(T_sp stream, T_sp buffer_mode_symbol) {
+T_sp core__set_buffering_mode(T_sp stream, T_sp buffer_mode_symbol, T_sp buffer_size_designator) {
   enum StreamMode mode = StreamMode(stream);
   int buffer_mode;
 
@@ -4148,12 +4715,19 @@ T_sp core__set_buffering_mode(T_sp stream, T_sp buffer_mode_symbol) {
     FILE *fp = IOStreamStreamFile(stream);
 
     if (buffer_mode != _IONBF) {
-      cl_index buffer_size = BUFSIZ;
+      cl_index buffer_size = buffer_size_designator.nilp() ? BUFSIZ : clasp_to_size(buffer_size_designator);
       char *new_buffer = gctools::clasp_alloc_atomic(buffer_size);
       StreamBuffer(stream) = new_buffer;
       setvbuf(fp, new_buffer, buffer_mode, buffer_size);
     } else
       setvbuf(fp, NULL, _IONBF, 0);
+  } else if (mode == clasp_smm_output_file || mode == clasp_smm_io_file || mode == clasp_smm_input_file) {
+    /* Descriptor streams have no line buffering - :line and :full both buffer */
+    if (buffer_mode != _IONBF) {
+      cl_index buffer_size = buffer_size_designator.nilp() ? CLASP_STREAM_DEFAULT_BUFFER_SIZE : clasp_to_size(buffer_size_designator);
+      io_file_set_buffer_size(stream, buffer_size);
+    } else
+      io_file_set_buffer_size(stream, 0);
   }
   return stream;
 }
@@ -4861,7 +5435,8 @@ FEinvalid_option(T_sp option, T_sp value) {
 
 T_sp clasp_open_stream(T_sp fn, enum StreamMode smm, T_sp if_exists,
                        T_sp if_does_not_exist, gctools::Fixnum byte_size,
-                       int flags, T_sp external_format) {
+                       int flags, T_sp external_format,
+                       T_sp buffer_size = _Nil<T_O>()) {
   T_sp output;
   int f;
 #if defined(CLASP_MS_WINDOWS_HOST)
@@ -4958,10 +5533,11 @@ T_sp clasp_open_stream(T_sp fn, enum StreamMode smm, T_sp if_exists,
     }
     output = clasp_make_stream_from_FILE(fn, fp, smm, byte_size, flags,
                                          external_format);
-    core__set_buffering_mode(output, byte_size ? kw::_sym_full : kw::_sym_line);
+    core__set_buffering_mode(output, byte_size ? kw::_sym_full : kw::_sym_line, buffer_size);
   } else {
     output = clasp_make_file_stream_from_fd(fn, f, smm, byte_size, flags,
-                                            external_format);
+                                            external_format,
+                                            buffer_size.nilp() ? CLASP_STREAM_DEFAULT_BUFFER_SIZE : clasp_to_size(buffer_size));
   }
   if (smm == clasp_smm_probe) {
     eval::funcall(cl::_sym_close, output);
@@ -4978,16 +5554,17 @@ T_sp clasp_open_stream(T_sp fn, enum StreamMode smm, T_sp if_exists,
   return output;
 }
 
-CL_LAMBDA("filename &key (direction :input) (element-type 'base-char) (if-exists nil iesp) (if-does-not-exist nil idnesp) (external-format :default) (cstream T)");
+CL_LAMBDA("filename &key (direction :input) (element-type 'base-char) (if-exists nil iesp) (if-does-not-exist nil idnesp) (external-format :default) (cstream T) (buffer-size nil)");
 CL_DECLARE();
-CL_DOCSTRING("open");
+CL_DOCSTRING("open - BUFFER-SIZE sets the size in bytes of the stream's buffer, 0 means unbuffered");
 CL_DEFUN T_sp cl__open(T_sp filename,
              T_sp direction,
              T_sp element_type,
              T_sp if_exists, bool iesp,
              T_sp if_does_not_exist, bool idnesp,
              T_sp external_format,
-             T_sp cstream) {
+             T_sp cstream,
+             T_sp buffer_size) {
   if (filename.nilp()) {
     TYPE_ERROR(filename,Cons_O::createList(cl::_sym_or,cl::_sym_string,cl::_sym_Pathname_O,cl::_sym_Stream_O));
   }
@@ -5038,8 +5615,11 @@ CL_DEFUN T_sp cl__open(T_sp filename,
   if (!cstream.nilp()) {
     flags |= CLASP_STREAM_C_STREAM;
   }
+  if (buffer_size.notnilp() && !(buffer_size.fixnump() && buffer_size.unsafe_fixnum() >= 0)) {
+    FEinvalid_option(kw::_sym_buffer_size, buffer_size);
+  }
   strm = clasp_open_stream(filename, smm, if_exists, if_does_not_exist,
-                           byte_size, flags, external_format);
+                           byte_size, flags, external_format, buffer_size);
   return strm;
 }
 
@@ -5405,6 +5985,11 @@ CL_DEFUN int core__stream_column(T_sp tstream) {
 
 namespace core {
 void clasp_write_characters(const char *buf, int sz, T_sp strm) {
+  BulkFormat fmt = bulk_format_for(strm, false);
+  if (fmt != bulk_none) {
+    bulk_write_chars(strm, fmt, reinterpret_cast<const unsigned char *>(buf), sz);
+    return;
+  }
   for (int i(0); i < sz; ++i) {
     clasp_write_char(buf[i], strm);
   }
@@ -5747,6 +6332,20 @@ CL_DEFUN T_mv cl__read_line(T_sp sin, T_sp eof_error_p, T_sp eof_value, T_sp rec
         return Values(eof_value,_lisp->_true());
       }
     }
+    return results;
+  }
+  {
+    T_sp line;
+    bool missing_newline;
+    switch (io_file_read_line(sin, line, missing_newline)) {
+    case 0:
+      if (eofErrorP) ERROR_END_OF_FILE(sin);
+      return Values(eof_value, _lisp->_true());
+    case 1:
+      return Values(line, _lisp->_boolean(missing_newline));
+    default:
+      break;
+    }
   }
   //    bool recursiveP = translate::from_object<bool>::convert(env->lookup(_sym_recursive_p));
   Str8Ns_sp sbuf = Str8Ns_O::createBufferString();
@@ -5837,8 +6436,9 @@ String_sp clasp_writeString(String_sp str, T_sp stream, int istart, T_sp end) {
   if (end.notnilp()) {
     iend = MIN(iend, unbox_fixnum(gc::As<Fixnum_sp>(end)));
   }
-  int ilen = iend - istart;
-  clasp_write_characters(&(str->get_std_string().c_str()[istart]), ilen, stream);
+  if (istart < iend) {
+    stream_dispatch_table(stream).write_vector(stream, str, istart, iend);
+  }
   return str;
 }
 
@@ -6048,6 +6648,7 @@ T_sp clasp_openWrite(T_sp path) {
 
 SYMBOL_EXPORT_SC_(ClPkg,open);
 SYMBOL_EXPORT_SC_(KeywordPkg,direction);
+SYMBOL_EXPORT_SC_(KeywordPkg,buffer_size);
 SYMBOL_EXPORT_SC_(KeywordPkg,output);
 SYMBOL_EXPORT_SC_(KeywordPkg,input);
   SYMBOL_EXPORT_SC_(ClPkg, filePosition);
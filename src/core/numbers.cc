@@ -194,28 +194,36 @@ Real_sp clasp_min2(Real_sp x, Real_sp y) {
   return min;
 }
 
-CL_LAMBDA(min &rest nums);
+CL_LAMBDA(min core:&va-rest nums);
 CL_DECLARE();
 CL_DOCSTRING("min");
-CL_DEFUN Real_sp cl__min(Real_sp min, List_sp nums) {
+CL_DEFUN Real_sp cl__min(Real_sp min, VaList_sp nums) {
   /* INV: type check occurs in clasp_number_compare() for the rest of
 	   numbers, but for the first argument it happens in clasp_zerop(). */
-  for (auto cur : nums) {
-    Real_sp numi = gc::As<Real_sp>(oCar(cur));
-    min = clasp_min2(min, numi);
+  while (nums->remaining_nargs() > 0) {
+    T_sp numi = nums->next_arg();
+    if (min.fixnump() && numi.fixnump()) {
+      if (numi.unsafe_fixnum() < min.unsafe_fixnum()) min = gc::As_unsafe<Real_sp>(numi);
+      continue;
+    }
+    min = clasp_min2(min, gc::As<Real_sp>(numi));
   }
   return min;
 }
 
-CL_LAMBDA(max &rest nums);
+CL_LAMBDA(max core:&va-rest nums);
 CL_DECLARE();
 CL_DOCSTRING("max");
-CL_DEFUN Real_sp cl__max(Real_sp max, List_sp nums) {
+CL_DEFUN Real_sp cl__max(Real_sp max, VaList_sp nums) {
   /* INV: type check occurs in clasp_number_compare() for the rest of
 	   numbers, but for the first argument it happens in clasp_zerop(). */
-  for (auto cur : nums) {
-    Real_sp numi = gc::As<Real_sp>(oCar(cur));
-    max = clasp_max2(max, numi);
+  while (nums->remaining_nargs() > 0) {
+    T_sp numi = nums->next_arg();
+    if (max.fixnump() && numi.fixnump()) {
+      if (numi.unsafe_fixnum() > max.unsafe_fixnum()) max = gc::As_unsafe<Real_sp>(numi);
+      continue;
+    }
+    max = clasp_max2(max, gc::As<Real_sp>(numi));
   }
   return max;
 }
@@ -393,19 +401,14 @@ inline CL_DEFUN Number_sp two_arg__PLUS_FF(Fixnum fa, Fixnum fb)
     return make_fixnum(fc);
   }
     // Overflow case
-  mpz_class za(static_cast<long>(fa));
-  mpz_class zb(static_cast<long>(fb));
-  mpz_class zc = za + zb;
-  return Integer_O::create(zc);
+  return _clasp_fix_plus_fix(fa, fb);
 }
 
 CL_NAME("TWO-ARG-+-FIXNUM-BIGNUM");
 inline
 CL_DEFUN Number_sp two_arg__PLUS_FB(Fixnum fx, Bignum_sp by)
 {
-  mpz_class zx(static_cast<long>(fx));
-  mpz_class zz = zx + by->mpz_ref();
-  return Integer_O::create(zz);
+  return _clasp_big_plus_fix(by->mpz_ref(), fx);
 }
 
 CL_NAME("TWO-ARG-+");
@@ -432,12 +435,10 @@ CL_DEFUN Number_sp contagen_add(Number_sp na, Number_sp nb) {
       return DoubleFloat_O::create(clasp_to_double(na) + clasp_to_double(nb));
     }
   case_Bignum_v_Fixnum : {
-      mpz_class zb(GMP_LONG(unbox_fixnum(gc::As<Fixnum_sp>(nb))));
-      mpz_class zc = gc::As<Bignum_sp>(na)->ref() + zb;
-      return Integer_O::create(zc);
+      return _clasp_big_plus_fix(gc::As_unsafe<Bignum_sp>(na)->ref(), nb.unsafe_fixnum());
     }
   case_Bignum_v_Bignum : {
-      return Integer_O::create(gc::As<Bignum_sp>(na)->ref() + gc::As<Bignum_sp>(nb)->ref());
+      return _clasp_big_plus_big(gc::As_unsafe<Bignum_sp>(na)->ref(), gc::As_unsafe<Bignum_sp>(nb)->ref());
     }
   case_Bignum_v_SingleFloat:
   case_Ratio_v_SingleFloat : {
@@ -535,15 +536,10 @@ CL_DEFUN Number_sp contagen_sub(Number_sp na, Number_sp nb) {
         return make_fixnum(fc);
       }
     // Overflow case
-      mpz_class za(GMP_LONG(unbox_fixnum(gc::As<Fixnum_sp>(na))));
-      mpz_class zb(GMP_LONG(unbox_fixnum(gc::As<Fixnum_sp>(nb))));
-      mpz_class zc = za - zb;
-      return Integer_O::create(zc);
+      return _clasp_fix_minus_fix(fa, fb);
     }
   case_Fixnum_v_Bignum : {
-      mpz_class za(GMP_LONG(unbox_fixnum(gc::As<Fixnum_sp>(na))));
-      mpz_class zc = za - gc::As<Bignum_sp>(nb)->ref();
-      return Integer_O::create(zc);
+      return _clasp_fix_minus_big(na.unsafe_fixnum(), gc::As_unsafe<Bignum_sp>(nb)->ref());
     }
   case_Fixnum_v_Ratio:
   case_Bignum_v_Ratio : {
@@ -561,12 +557,11 @@ CL_DEFUN Number_sp contagen_sub(Number_sp na, Number_sp nb) {
       return DoubleFloat_O::create(clasp_to_double(na) - clasp_to_double(nb));
     }
   case_Bignum_v_Fixnum : {
-      mpz_class zb(GMP_LONG(unbox_fixnum(gc::As<Fixnum_sp>(nb))));
-      mpz_class zc = gc::As<Bignum_sp>(na)->ref() - zb;
-      return Integer_O::create(zc);
+      // x - y is x + (-y), and -y of a fixnum is still a Fixnum
+      return _clasp_big_plus_fix(gc::As_unsafe<Bignum_sp>(na)->ref(), -nb.unsafe_fixnum());
     }
   case_Bignum_v_Bignum : {
-      return Integer_O::create(gc::As<Bignum_sp>(na)->ref() - gc::As<Bignum_sp>(nb)->ref());
+      return _clasp_big_minus_big(gc::As_unsafe<Bignum_sp>(na)->ref(), gc::As_unsafe<Bignum_sp>(nb)->ref());
     }
   case_Bignum_v_SingleFloat:
   case_Ratio_v_SingleFloat : {
@@ -651,15 +646,10 @@ CL_NAME("TWO-ARG-*");
 CL_DEFUN Number_sp contagen_mul(Number_sp na, Number_sp nb) {
   MATH_DISPATCH_BEGIN(na, nb) {
   case_Fixnum_v_Fixnum : {
-      mpz_class za(GMP_LONG(unbox_fixnum(gc::As<Fixnum_sp>(na))));
-      mpz_class zb(GMP_LONG(unbox_fixnum(gc::As<Fixnum_sp>(nb))));
-      mpz_class zc = za * zb;
-      return Integer_O::create(zc);
+      return _clasp_fix_times_fix(na.unsafe_fixnum(), nb.unsafe_fixnum());
     }
   case_Fixnum_v_Bignum : {
-      mpz_class za(GMP_LONG(unbox_fixnum(gc::As<Fixnum_sp>(na))));
-      mpz_class zc = za * gc::As<Bignum_sp>(nb)->ref();
-      return Integer_O::create(zc);
+      return _clasp_big_times_fix(gc::As_unsafe<Bignum_sp>(nb)->ref(), na.unsafe_fixnum());
     }
   case_Fixnum_v_Ratio:
   case_Bignum_v_Ratio : {
@@ -675,12 +665,10 @@ CL_DEFUN Number_sp contagen_mul(Number_sp na, Number_sp nb) {
       return DoubleFloat_O::create(clasp_to_double(na) * clasp_to_double(nb));
     }
   case_Bignum_v_Fixnum : {
-      mpz_class zb(GMP_LONG(unbox_fixnum(gc::As<Fixnum_sp>(nb))));
-      mpz_class zc = gc::As<Bignum_sp>(na)->ref() * zb;
-      return Integer_O::create(zc);
+      return _clasp_big_times_fix(gc::As_unsafe<Bignum_sp>(na)->ref(), nb.unsafe_fixnum());
     }
   case_Bignum_v_Bignum : {
-      return Integer_O::create(gc::As<Bignum_sp>(na)->ref() * gc::As<Bignum_sp>(nb)->ref());
+      return _clasp_big_times_big(gc::As_unsafe<Bignum_sp>(na)->ref(), gc::As_unsafe<Bignum_sp>(nb)->ref());
     }
   case_Bignum_v_SingleFloat:
   case_Ratio_v_SingleFloat : {
@@ -871,52 +859,101 @@ CL_DEFUN Number_sp contagen_div(Number_sp na, Number_sp nb) {
   not_comparable_error(na, nb);
 }
 
-CL_LAMBDA(&rest numbers);
-CL_DEFUN T_mv cl___PLUS_(List_sp numbers) {
-  if (numbers.nilp())
-    return (Values(make_fixnum(0)));
-  Number_sp result = gc::As<Number_sp>(oCar(numbers));
-  for (auto cur : (List_sp)oCdr(numbers)) {
-    result = contagen_add(result, gc::As<Number_sp>(oCar(cur)));
+/*! The n-ary arithmetic functions accumulate into a machine word for as
+    long as the arguments are fixnums and nothing overflows, then box the
+    partial result and continue with the generic contagion functions. */
+CL_LAMBDA(core:&va-rest numbers);
+CL_DEFUN T_mv cl___PLUS_(VaList_sp numbers) {
+  size_t nargs = numbers->remaining_nargs();
+  gc::Fixnum acc = 0;
+  while (numbers->remaining_nargs() > 0) {
+    bool first = numbers->remaining_nargs() == nargs;
+    T_sp arg = numbers->next_arg();
+    gc::Fixnum next;
+    if (arg.fixnump() && !__builtin_add_overflow(acc, arg.unsafe_fixnum(), &next)) {
+      acc = next;
+      continue;
+    }
+    // Don't add the leading fixnum zero to the first argument, (+ -0.0) is -0.0
+    Number_sp result = first ? gc::As<Number_sp>(arg) : contagen_add(Integer_O::create(acc), gc::As<Number_sp>(arg));
+    while (numbers->remaining_nargs() > 0) {
+      result = contagen_add(result, gc::As<Number_sp>(numbers->next_arg()));
+    }
+    return (Values(result));
   }
-  return (Values(result));
+  return (Values(Integer_O::create(acc)));
 }
 
-CL_LAMBDA(&rest numbers);
+CL_LAMBDA(core:&va-rest numbers);
 CL_DECLARE();
 CL_DOCSTRING("See CLHS: *");
-CL_DEFUN T_mv cl___TIMES_(List_sp numbers) {
-  if (numbers.nilp())
-    return (Values(make_fixnum(1)));
-  Number_sp result = gc::As<Number_sp>(oCar(numbers));
-  for (auto cur : (List_sp)oCdr(numbers)) {
-    result = contagen_mul(result, gc::As<Number_sp>(oCar(cur)));
+CL_DEFUN T_mv cl___TIMES_(VaList_sp numbers) {
+  gc::Fixnum acc = 1;
+  while (numbers->remaining_nargs() > 0) {
+    T_sp arg = numbers->next_arg();
+    gc::Fixnum next;
+    if (arg.fixnump() && !__builtin_mul_overflow(acc, arg.unsafe_fixnum(), &next)) {
+      acc = next;
+      continue;
+    }
+    Number_sp result = contagen_mul(Integer_O::create(acc), gc::As<Number_sp>(arg));
+    while (numbers->remaining_nargs() > 0) {
+      result = contagen_mul(result, gc::As<Number_sp>(numbers->next_arg()));
+    }
+    return (Values(result));
   }
-  return (Values(result));
+  return (Values(Integer_O::create(acc)));
 }
 
-CL_LAMBDA(num &rest numbers);
+CL_LAMBDA(num core:&va-rest numbers);
 CL_DECLARE();
 CL_DOCSTRING("See CLHS: +");
-CL_DEFUN T_mv cl___MINUS_(Number_sp num, List_sp numbers) {
-  if (numbers.nilp()) {
+CL_DEFUN T_mv cl___MINUS_(Number_sp num, VaList_sp numbers) {
+  if (numbers->remaining_nargs() == 0) {
     return (Values(clasp_negate(num)));
   }
+  if (num.fixnump()) {
+    gc::Fixnum acc = num.unsafe_fixnum();
+    while (numbers->remaining_nargs() > 0) {
+      T_sp arg = numbers->next_arg();
+      gc::Fixnum next;
+      if (arg.fixnump() && !__builtin_sub_overflow(acc, arg.unsafe_fixnum(), &next)) {
+        acc = next;
+        continue;
+      }
+      Number_sp result = contagen_sub(Integer_O::create(acc), gc::As<Number_sp>(arg));
+      while (numbers->remaining_nargs() > 0) {
+        result = contagen_sub(result, gc::As<Number_sp>(numbers->next_arg()));
+      }
+      return (Values(result));
+    }
+    return (Values(Integer_O::create(acc)));
+  }
   Number_sp result = num;
-  for (auto cur : (List_sp)(numbers)) {
-    result = contagen_sub(result, gc::As<Number_sp>(oCar(cur)));
+  while (numbers->remaining_nargs() > 0) {
+    result = contagen_sub(result, gc::As<Number_sp>(numbers->next_arg()));
   }
   return (Values(result));
 }
 
-CL_LAMBDA(num &rest numbers);
-CL_DEFUN T_sp cl___DIVIDE_(Number_sp num, List_sp numbers) {
-  if (numbers.nilp()) {
+CL_LAMBDA(num core:&va-rest numbers);
+CL_DEFUN T_sp cl___DIVIDE_(Number_sp num, VaList_sp numbers) {
+  if (numbers->remaining_nargs() == 0) {
     return (clasp_reciprocal(num));
   }
   Number_sp result = num;
-  for (auto cur : (List_sp)(numbers)) {
-    result = contagen_div(result, gc::As<Number_sp>(oCar(cur)));
+  // Fixnum quotients stay fixnums while every division is exact
+  while (numbers->remaining_nargs() > 0) {
+    Number_sp arg = gc::As<Number_sp>(numbers->next_arg());
+    if (result.fixnump() && arg.fixnump()) {
+      gc::Fixnum x = result.unsafe_fixnum();
+      gc::Fixnum y = arg.unsafe_fixnum();
+      if (y != 0 && x % y == 0) {
+        result = Integer_O::create(x / y);
+        continue;
+      }
+    }
+    result = contagen_div(result, arg);
   }
   return ((result));
 }
@@ -1182,18 +1219,21 @@ int basic_compare(Number_sp na, Number_sp nb) {
   MATH_DISPATCH_END();
 }
 
-T_sp numbers_monotonic(int s, int t, List_sp args) {
-  Number_sp c = gc::As<Number_sp>(oCar(args));
-  Number_sp d;
+T_sp numbers_monotonic(int s, int t, VaList_sp args) {
+  T_sp c = gc::As<Number_sp>(args->next_arg());
   int dir;
-  args = oCdr(args);
-  while (args.notnilp()) {
-    d = gc::As<Number_sp>(oCar(args));
-    dir = s * basic_compare(c, d);
+  while (args->remaining_nargs() > 0) {
+    T_sp d = args->next_arg();
+    if (c.fixnump() && d.fixnump()) {
+      gc::Fixnum fc = c.unsafe_fixnum();
+      gc::Fixnum fd = d.unsafe_fixnum();
+      dir = s * ((fc < fd) ? -1 : (fc == fd) ? 0 : 1);
+    } else {
+      dir = s * basic_compare(gc::As<Number_sp>(c), gc::As<Number_sp>(d));
+    }
     if (dir < t)
       return _lisp->_false();
     c = d;
-    args = oCdr(args);
   }
   return _lisp->_true();
 };
@@ -1218,30 +1258,30 @@ CL_DEFUN bool two_arg__GE_(Number_sp x, Number_sp y) {
   return basic_compare(x, y) != -1;
 }
 
-CL_LAMBDA(&rest args);
-CL_DEFUN T_sp cl___LT_(List_sp args) {
-  if (args.nilp())
+CL_LAMBDA(core:&va-rest args);
+CL_DEFUN T_sp cl___LT_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return numbers_monotonic(-1, 1, args);
 };
 
-CL_LAMBDA(&rest args);
-CL_DEFUN T_mv cl___GT_(List_sp args) {
-  if (args.nilp())
+CL_LAMBDA(core:&va-rest args);
+CL_DEFUN T_mv cl___GT_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return (Values(numbers_monotonic(1, 1, args)));
 };
 
-CL_LAMBDA(&rest args);
-CL_DEFUN T_mv cl___LE_(List_sp args) {
-  if (args.nilp())
+CL_LAMBDA(core:&va-rest args);
+CL_DEFUN T_mv cl___LE_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return (Values(numbers_monotonic(-1, 0, args)));
 };
 
-CL_LAMBDA(&rest args);
-CL_DEFUN T_mv cl___GE_(List_sp args) {
-  if (args.nilp())
+CL_LAMBDA(core:&va-rest args);
+CL_DEFUN T_mv cl___GE_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
       PROGRAM_ERROR();
   return (Values(numbers_monotonic(1, 0, args)));
 };
@@ -1381,41 +1421,43 @@ CL_DEFUN bool two_arg__EQ_(Number_sp x, Number_sp y) {
   return basic_equalp(x, y);
 }
 
+static inline bool numbers_equalp(T_sp a, T_sp b) {
+  if (a.fixnump() && b.fixnump())
+    return a.unsafe_fixnum() == b.unsafe_fixnum();
+  return basic_equalp(gc::As<Number_sp>(a), gc::As<Number_sp>(b));
+}
+
 CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("NE");
 CL_DEFUN T_sp cl___NE_(VaList_sp args) {
-  if (args->remaining_nargs() == 1) return _lisp->_true();
-  if (args->remaining_nargs()==0) return _lisp->_true();
-  if (args->remaining_nargs() == 2) {
-    Number_sp a = gc::As<Number_sp>(args->next_arg());
-    Number_sp b = gc::As<Number_sp>(args->next_arg());
-    if (basic_equalp(a, b)) return _Nil<T_O>();
+  size_t nargs = args->remaining_nargs();
+  if (nargs == 0)
     return _lisp->_true();
-  }
-  if (args->remaining_nargs() == 3) {
-    Number_sp a = gc::As<Number_sp>(args->next_arg());
-    Number_sp b = gc::As<Number_sp>(args->next_arg());
-    Number_sp c = gc::As<Number_sp>(args->next_arg());
-    if (basic_equalp(a, b)) return _Nil<T_O>();
-    if (basic_equalp(a, c)) return _Nil<T_O>();
-    if (basic_equalp(b, c)) return _Nil<T_O>();
+  if (nargs == 1) {
+    gc::As<Number_sp>(args->next_arg());
     return _lisp->_true();
   }
-  SIMPLE_ERROR(BF("Handle /= with more than 3 arguments"));
+  for (size_t i = 0; i < nargs; ++i) {
+    T_sp a((gctools::Tagged)args->relative_indexed_arg(i));
+    for (size_t j = i + 1; j < nargs; ++j) {
+      T_sp b((gctools::Tagged)args->relative_indexed_arg(j));
+      if (numbers_equalp(a, b))
+        return _Nil<T_O>();
+    }
+  }
+  return _lisp->_true();
 }
 
-CL_LAMBDA(&rest args);
+CL_LAMBDA(core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("_EQ_");
-CL_DEFUN T_sp cl___EQ_(List_sp args) {
-  if (args.nilp())
+CL_DEFUN T_sp cl___EQ_(VaList_sp args) {
+  if (args->remaining_nargs() == 0)
     return (_lisp->_true());
-  Number_sp a = gc::As<Number_sp>(oCar(args));
-  Number_sp b;
-  for (auto cur : (List_sp)oCdr(args)) {
-    b = gc::As<Number_sp>(oCar(cur));
-    if (!basic_equalp(a, b))
+  T_sp a = gc::As<Number_sp>(args->next_arg());
+  while (args->remaining_nargs() > 0) {
+    if (!numbers_equalp(a, args->next_arg()))
       return _Nil<T_O>();
   }
   return _lisp->_true();
@@ -1491,8 +1533,7 @@ Integer_sp Integer_O::create( gctools::Fixnum v )
     return make_fixnum(v);
   }
 
-  Bignum z(GMP_LONG(v));
-  return Bignum_O::create( z );
+  return Bignum_O::create( v );
 }
 
 
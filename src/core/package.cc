@@ -130,8 +130,7 @@ CL_DECLARE();
 CL_DOCSTRING("findSymbol");
 CL_DEFUN T_mv cl__find_symbol(String_sp symbolName, T_sp packageDesig) {
   Package_sp package = coerce::packageDesignator(packageDesig);
-  SimpleString_sp simple_symbol_name = coerce::simple_string(symbolName);
-  return package->findSymbol_SimpleString(simple_symbol_name);
+  return package->findSymbol(symbolName);
 };
 
 CL_LAMBDA("package-name &key nicknames (use (list \"CL\"))");
@@ -234,16 +233,14 @@ CL_DEFUN T_sp cl__delete_package(T_sp pobj)
     if (pi.notnilp())
       pi->unusePackage_no_inner_lock(pkg);
   }
-  pkg->_InternalSymbols->mapHash([pkg](T_sp key, T_sp tsym) {
-      Symbol_sp sym = gc::As<Symbol_sp>(tsym);
+  pkg->_InternalSymbols.mapSymbols([pkg](Symbol_sp sym) {
       sym->remove_package(pkg);
     } );
-  pkg->_InternalSymbols->clrhash();
-  pkg->_ExternalSymbols->mapHash([pkg](T_sp key, T_sp tsym) {
-      Symbol_sp sym = gc::As<Symbol_sp>(tsym);
+  pkg->_InternalSymbols.clear();
+  pkg->_ExternalSymbols.mapSymbols([pkg](Symbol_sp sym) {
       sym->remove_package(pkg);
     } );
-  pkg->_ExternalSymbols->clrhash();
+  pkg->_ExternalSymbols.clear();
   pkg->_Shadowing->clrhash();
   string package_name = pkg->packageName();
   pkg->_Name = SimpleBaseString_O::make("");
@@ -299,6 +296,17 @@ CL_DEFUN_SETF T_sp set_package_documentation(T_sp documentation, Package_sp pack
   return documentation;
 }
 
+CL_LAMBDA(function package kind);
+CL_DOCSTRING("Call FUNCTION on each symbol present in PACKAGE, KIND is :EXTERNAL or :INTERNAL. FUNCTION runs under the package read lock and must not modify PACKAGE.");
+CL_DEFUN void core__map_package_symbols(Function_sp function, Package_sp package, Symbol_sp kind) {
+  WITH_PACKAGE_READ_LOCK(package);
+  SymbolNameTable *table = NULL;
+  if (kind == kw::_sym_external) table = &package->_ExternalSymbols;
+  else if (kind == kw::_sym_internal) table = &package->_InternalSymbols;
+  else SIMPLE_ERROR(BF("map-package-symbols kind must be :external or :internal - not %s") % _rep_(kind));
+  table->mapSymbols([&function](Symbol_sp sym) { eval::funcall(function, sym); });
+}
+
 CL_LAMBDA(symbol-names-desig &optional (package-desig *package*));
 CL_DECLARE();
 CL_DOCSTRING("See CLHS: shadowing-import");
@@ -391,6 +399,191 @@ SYMBOL_EXPORT_SC_(ClPkg, unintern);
 
 
 
+// ------------------------------------------------------------
+//
+// SymbolNameTable
+//
+
+#define SYMBOL_NAME_HASH_EMPTY 0
+#define SYMBOL_NAME_HASH_DELETED 1
+// Every live hash has its top bit set so it can't be EMPTY or DELETED
+#define SYMBOL_NAME_HASH_LIVE 0x8000000000000000ULL
+#define SYMBOL_NAME_TABLE_INITIAL_CAPACITY 16
+
+/*! Base and character strings with the same characters hash the same */
+template <typename SimpleType>
+inline uint64_t symbol_name_hash(const SimpleType &chars, size_t start, size_t end) {
+  return hash_string_chars(chars.begin()+start,end-start) | SYMBOL_NAME_HASH_LIVE;
+}
+
+template <typename SimpleType1, typename SimpleType2>
+inline bool symbol_name_EQ(const SimpleType1 &chars1, size_t start1, const SimpleType2 &chars2, size_t start2, size_t length) {
+  for ( size_t i(0); i<length; ++i ) {
+    if ((claspCharacter)chars1[start1+i] != (claspCharacter)chars2[start2+i]) return false;
+  }
+  return true;
+}
+
+SymbolNameKey::SymbolNameKey(String_sp name) {
+  name->asAbstractSimpleVectorRange(this->_Chars,this->_Start,this->_End);
+  if (SimpleBaseString_sp base = this->_Chars.asOrNull<SimpleBaseString_O>()) {
+    this->_Hash = symbol_name_hash(*base,this->_Start,this->_End);
+  } else {
+    this->_Hash = symbol_name_hash(*gc::As_unsafe<SimpleCharacterString_sp>(this->_Chars),this->_Start,this->_End);
+  }
+}
+
+bool SymbolNameKey::matches(SimpleString_sp name) const {
+  size_t length = this->length();
+  if (name->length() != length) return false;
+  if (SimpleBaseString_sp base = this->_Chars.asOrNull<SimpleBaseString_O>()) {
+    if (SimpleBaseString_sp other = name.asOrNull<SimpleBaseString_O>()) {
+      return length == 0 || memcmp(&(*base)[this->_Start],&(*other)[0],length) == 0;
+    }
+    return symbol_name_EQ(*base,this->_Start,*gc::As_unsafe<SimpleCharacterString_sp>(name),0,length);
+  }
+  SimpleCharacterString_sp wide = gc::As_unsafe<SimpleCharacterString_sp>(this->_Chars);
+  if (SimpleBaseString_sp other = name.asOrNull<SimpleBaseString_O>()) {
+    return symbol_name_EQ(*wide,this->_Start,*other,0,length);
+  }
+  return symbol_name_EQ(*wide,this->_Start,*gc::As_unsafe<SimpleCharacterString_sp>(name),0,length);
+}
+
+inline size_t symbol_name_index(uint64_t hash, size_t mask) {
+  return (hash ^ (hash >> 29)) & mask;
+}
+
+void SymbolNameTable::initialize() {
+  this->_Entries = SimpleVector_O::make(2*SYMBOL_NAME_TABLE_INITIAL_CAPACITY);
+  this->_Hashes = SimpleVector_byte64_t_O::make(SYMBOL_NAME_TABLE_INITIAL_CAPACITY,SYMBOL_NAME_HASH_EMPTY,true);
+  this->_Count = 0;
+  this->_Used = 0;
+}
+
+bool SymbolNameTable::find(const SymbolNameKey &key, Symbol_sp &sym) const {
+  SimpleVector_byte64_t_O &hashes = *this->_Hashes;
+  SimpleVector_O &entries = *this->_Entries;
+  size_t mask = hashes.length() - 1;
+  for ( size_t i = symbol_name_index(key._Hash,mask); ; i = (i+1)&mask ) {
+    uint64_t hash = hashes[i];
+    if (hash == SYMBOL_NAME_HASH_EMPTY) return false;
+    if (hash == key._Hash && key.matches(gc::As_unsafe<SimpleString_sp>(entries[2*i]))) {
+      sym = gc::As_unsafe<Symbol_sp>(entries[2*i+1]);
+      return true;
+    }
+  }
+}
+
+void SymbolNameTable::rehash(size_t capacity) {
+  SimpleVector_sp oldEntries = this->_Entries;
+  SimpleVector_byte64_t_sp oldHashes = this->_Hashes;
+  SimpleVector_sp entries = SimpleVector_O::make(2*capacity);
+  SimpleVector_byte64_t_sp hashes = SimpleVector_byte64_t_O::make(capacity,SYMBOL_NAME_HASH_EMPTY,true);
+  size_t mask = capacity - 1;
+  for ( size_t j(0), jEnd(oldHashes->length()); j<jEnd; ++j ) {
+    uint64_t hash = (*oldHashes)[j];
+    if (hash == SYMBOL_NAME_HASH_EMPTY || hash == SYMBOL_NAME_HASH_DELETED) continue;
+    size_t i = symbol_name_index(hash,mask);
+    while ((*hashes)[i] != SYMBOL_NAME_HASH_EMPTY) i = (i+1)&mask;
+    (*hashes)[i] = hash;
+    (*entries)[2*i] = (*oldEntries)[2*j];
+    (*entries)[2*i+1] = (*oldEntries)[2*j+1];
+  }
+  this->_Entries = entries;
+  this->_Hashes = hashes;
+  this->_Used = this->_Count;
+}
+
+void SymbolNameTable::insert(const SymbolNameKey &key, SimpleString_sp name, Symbol_sp sym) {
+  size_t capacity = this->_Hashes->length();
+  // Keep at most 3/4 of the slots used so probes always reach an empty slot
+  if ((this->_Used+1)*4 > capacity*3) {
+    this->rehash((this->_Count+1)*2 > capacity/2 ? capacity*2 : capacity);
+  }
+  SimpleVector_byte64_t_O &hashes = *this->_Hashes;
+  SimpleVector_O &entries = *this->_Entries;
+  size_t mask = hashes.length() - 1;
+  size_t free_slot = hashes.length();
+  size_t i = symbol_name_index(key._Hash,mask);
+  for ( ; ; i = (i+1)&mask ) {
+    uint64_t hash = hashes[i];
+    if (hash == SYMBOL_NAME_HASH_EMPTY) break;
+    if (hash == SYMBOL_NAME_HASH_DELETED) {
+      if (free_slot == hashes.length()) free_slot = i;
+    } else if (hash == key._Hash && key.matches(gc::As_unsafe<SimpleString_sp>(entries[2*i]))) {
+      entries[2*i] = name;
+      entries[2*i+1] = sym;
+      return;
+    }
+  }
+  if (free_slot == hashes.length()) {
+    free_slot = i;
+    ++this->_Used;
+  }
+  hashes[free_slot] = key._Hash;
+  entries[2*free_slot] = name;
+  entries[2*free_slot+1] = sym;
+  ++this->_Count;
+}
+
+bool SymbolNameTable::remove(const SymbolNameKey &key) {
+  SimpleVector_byte64_t_O &hashes = *this->_Hashes;
+  SimpleVector_O &entries = *this->_Entries;
+  size_t mask = hashes.length() - 1;
+  for ( size_t i = symbol_name_index(key._Hash,mask); ; i = (i+1)&mask ) {
+    uint64_t hash = hashes[i];
+    if (hash == SYMBOL_NAME_HASH_EMPTY) return false;
+    if (hash == key._Hash && key.matches(gc::As_unsafe<SimpleString_sp>(entries[2*i]))) {
+      hashes[i] = SYMBOL_NAME_HASH_DELETED;
+      entries[2*i] = _Nil<T_O>();
+      entries[2*i+1] = _Nil<T_O>();
+      --this->_Count;
+      return true;
+    }
+  }
+}
+
+void SymbolNameTable::clear() {
+  this->initialize();
+}
+
+void SymbolNameTable::map(KeyValueMapper *mapper) const {
+  SimpleVector_sp entries = this->_Entries;
+  SimpleVector_byte64_t_sp hashes = this->_Hashes;
+  for ( size_t i(0), iEnd(hashes->length()); i<iEnd; ++i ) {
+    uint64_t hash = (*hashes)[i];
+    if (hash == SYMBOL_NAME_HASH_EMPTY || hash == SYMBOL_NAME_HASH_DELETED) continue;
+    if (!mapper->mapKeyValue((*entries)[2*i],(*entries)[2*i+1])) return;
+  }
+}
+
+void SymbolNameTable::mapSymbols(std::function<void(Symbol_sp)> const &fn) const {
+  SimpleVector_sp entries = this->_Entries;
+  SimpleVector_byte64_t_sp hashes = this->_Hashes;
+  for ( size_t i(0), iEnd(hashes->length()); i<iEnd; ++i ) {
+    uint64_t hash = (*hashes)[i];
+    if (hash == SYMBOL_NAME_HASH_EMPTY || hash == SYMBOL_NAME_HASH_DELETED) continue;
+    fn(gc::As_unsafe<Symbol_sp>((*entries)[2*i+1]));
+  }
+}
+
+HashTableEqual_sp SymbolNameTable::asHashTable() const {
+  HashTableEqual_sp table = HashTableEqual_O::create_default();
+  SimpleVector_sp entries = this->_Entries;
+  SimpleVector_byte64_t_sp hashes = this->_Hashes;
+  for ( size_t i(0), iEnd(hashes->length()); i<iEnd; ++i ) {
+    uint64_t hash = (*hashes)[i];
+    if (hash == SYMBOL_NAME_HASH_EMPTY || hash == SYMBOL_NAME_HASH_DELETED) continue;
+    table->hash_table_setf_gethash((*entries)[2*i],(*entries)[2*i+1]);
+  }
+  return table;
+}
+
+// ------------------------------------------------------------
+//
+// Package_O
+//
+
 Package_sp Package_O::create(const string &name) {
   Package_sp p = Package_O::create();
   p->setName(name);
@@ -400,8 +593,8 @@ Package_sp Package_O::create(const string &name) {
 void Package_O::initialize() {
   WITH_PACKAGE_READ_WRITE_LOCK(this);
   this->Base::initialize();
-  this->_InternalSymbols = HashTableEqual_O::create_default();
-  this->_ExternalSymbols = HashTableEqual_O::create_default();
+  this->_InternalSymbols.initialize();
+  this->_ExternalSymbols.initialize();
   this->_Shadowing = HashTableEq_O::create_default();
   this->_KeywordPackage = false;
   this->_AmpPackage = false;
@@ -428,7 +621,7 @@ CL_DEFMETHOD T_mv Package_O::hashTables() const {
        ci != this->_UsingPackages.end(); ci++) {
     useList = Cons_O::create(*ci, useList);
   }
-  return Values(this->_ExternalSymbols, this->_InternalSymbols, useList);
+  return Values(this->_ExternalSymbols.asHashTable(), this->_InternalSymbols.asHashTable(), useList);
 }
 
 string Package_O::__repr__() const {
@@ -464,31 +657,36 @@ string Package_O::allSymbols() {
   WITH_PACKAGE_READ_LOCK(this);
   stringstream ss;
   PackageMapper internals("internal", &ss);
-  this->_InternalSymbols->lowLevelMapHash(&internals);
+  this->_InternalSymbols.map(&internals);
   PackageMapper externals("external", &ss);
-  this->_ExternalSymbols->lowLevelMapHash(&externals);
+  this->_ExternalSymbols.map(&externals);
   return ss.str();
 }
 
 Symbol_mv Package_O::findSymbol_SimpleString_no_lock(SimpleString_sp nameKey) const {
-//  client_validate(nameKey);
-  T_mv ei = this->_ExternalSymbols->gethash(nameKey, _Nil<T_O>());
-//  client_validate(nameKey);
-  Symbol_sp val = gc::As<Symbol_sp>(ei);
-  bool foundp = ei.second().isTrue();
-  if (foundp) {
-//    client_validate(val->_Name);
+  return this->findSymbol_no_lock(nameKey);
+}
+
+/*! Names can be any string (e.g. a reader buffer with a fill pointer),
+    they are never copied to a simple-string. */
+Symbol_mv Package_O::findSymbol_no_lock(String_sp nameKey) const {
+  SymbolNameKey key(nameKey);
+  return this->findSymbol_no_lock(key);
+}
+
+/*! The name is hashed once by the caller and that hash is reused for
+    this package's tables and for the externals of every used package */
+Symbol_mv Package_O::findSymbol_no_lock(const SymbolNameKey &key) const {
+  Symbol_sp val;
+  if (this->_ExternalSymbols.find(key,val)) {
     LOG(BF("Found it in the _ExternalsSymbols list - returning[%s]") % (_rep_(val)));
     return Values(val, kw::_sym_external);
   }
   // There is no need to look further if this is the keyword package
   if (this->isKeywordPackage())
     return Values(_Nil<T_O>(), _Nil<T_O>());
-  T_mv ej = this->_InternalSymbols->gethash(nameKey, _Nil<T_O>());
-  val = gc::As<Symbol_sp>(ej);
-  foundp = ej.second().isTrue();
-  if (foundp) {
-    LOG(BF("Found it in the _InternalSymbols list - returning[%s]") % (_rep_(first)));
+  if (this->_InternalSymbols.find(key,val)) {
+    LOG(BF("Found it in the _InternalSymbols list - returning[%s]") % (_rep_(val)));
     return (Values(val, kw::_sym_internal));
   }
   {
@@ -496,10 +694,7 @@ Symbol_mv Package_O::findSymbol_SimpleString_no_lock(SimpleString_sp nameKey) co
     for (auto it = this->_UsingPackages.begin(); it != this->_UsingPackages.end(); it++) {
       Package_sp upkg = *it;
       LOG(BF("Looking in package[%s]") % _rep_(upkg));
-      T_mv eu = upkg->_ExternalSymbols->gethash(nameKey, _Nil<T_O>());
-      val = gc::As<Symbol_sp>(eu);
-      foundp = ei.second().isTrue();
-      if (foundp) {
+      if (upkg->_ExternalSymbols.find(key,val)) {
         LOG(BF("Found it in the _ExternalsSymbols list - returning[%s]") % (_rep_(val)));
         return Values(val, kw::_sym_inherited);
       }
@@ -519,8 +714,8 @@ Symbol_mv Package_O::findSymbol(const string &name) const {
 }
 
 Symbol_mv Package_O::findSymbol(String_sp s) const {
-  SimpleString_sp ss = coerce::simple_string(s);
-  return this->findSymbol_SimpleString(ss);
+  WITH_PACKAGE_READ_LOCK(this);
+  return this->findSymbol_no_lock(s);
 }
 
 List_sp Package_O::packageUseList() {
@@ -543,18 +738,6 @@ List_sp Package_O::packageUsedByList() {
   return res;
 }
 
-T_mv Package_O::packageHashTables() const {
-  WITH_PACKAGE_READ_LOCK(this);
-  List_sp usingPackages = _Nil<List_V>();
-  for (auto si = this->_UsingPackages.begin();
-       si != this->_UsingPackages.end(); si++) {
-    usingPackages = Cons_O::create(*si, usingPackages);
-  }
-  return (Values(this->_ExternalSymbols,
-                 this->_InternalSymbols,
-                 usingPackages));
-}
-
 bool Package_O::usingPackageP_no_lock(Package_sp usePackage) const {
   for (auto it = this->_UsingPackages.begin(); it != this->_UsingPackages.end(); ++it) {
     if ((*it) == usePackage) return true;
@@ -607,7 +790,7 @@ bool Package_O::usePackage(Package_sp usePackage) {
     }
     FindConflicts findConflicts(this->asSmartPtr());
     {
-      usePackage->_ExternalSymbols->lowLevelMapHash(&findConflicts);
+      usePackage->_ExternalSymbols.map(&findConflicts);
       if (findConflicts._conflicts->hashTableCount() > 0) {
         stringstream ss;
         findConflicts._conflicts->mapHash([&ss] (T_sp key, T_sp val) {
@@ -715,11 +898,12 @@ typedef enum { no_problem,
                name_conflict_in_other_package } Export_errors;
 void Package_O::_export2(Symbol_sp sym) {
   SimpleString_sp nameKey = sym->_Name;
+  SymbolNameKey key(nameKey);
   Package_sp error_pkg;
   Export_errors error;
   {
     WITH_PACKAGE_READ_WRITE_LOCK(this);
-    T_mv values = this->findSymbol_SimpleString_no_lock(nameKey);
+    T_mv values = this->findSymbol_no_lock(key);
     Symbol_sp foundSym = gc::As<Symbol_sp>(values);
     Symbol_sp status = gc::As<Symbol_sp>(values.second());
     if (status.nilp()) {
@@ -733,9 +917,9 @@ void Package_O::_export2(Symbol_sp sym) {
       error_pkg = pkg_with_conflict;
     } else {
       if (status == kw::_sym_internal) {
-        this->_InternalSymbols->remhash(nameKey);
+        this->_InternalSymbols.remove(key);
       }
-      this->add_symbol_to_package_no_lock(nameKey,sym,true);
+      this->_ExternalSymbols.insert(key,nameKey,sym);
       error = no_problem;
     }
   } // TO HERE
@@ -800,8 +984,9 @@ void Package_O::unexport(Symbol_sp sym) {
     if (status.nilp()) {
       error = not_accessible_in_this_package;
     } else if (status == kw::_sym_external) {
-      this->_ExternalSymbols->remhash(nameKey);
-      this->_InternalSymbols->setf_gethash(nameKey,sym);
+      SymbolNameKey key(nameKey);
+      this->_ExternalSymbols.remove(key);
+      this->_InternalSymbols.insert(key,nameKey,sym);
     }
   }
   if (error == not_accessible_in_this_package) {
@@ -813,10 +998,11 @@ void Package_O::unexport(Symbol_sp sym) {
 }
 
 void Package_O::add_symbol_to_package_no_lock(SimpleString_sp nameKey, Symbol_sp sym, bool exportp) {
+  SymbolNameKey key(nameKey);
   if (this->isKeywordPackage() || this->actsLikeKeywordPackage() || exportp) {
-    this->_ExternalSymbols->hash_table_setf_gethash(nameKey, sym);
+    this->_ExternalSymbols.insert(key, nameKey, sym);
   } else {
-    this->_InternalSymbols->hash_table_setf_gethash(nameKey, sym);
+    this->_InternalSymbols.insert(key, nameKey, sym);
   }
 }
 
@@ -839,7 +1025,8 @@ void Package_O::bootstrap_add_symbol_to_package(const char *symName, Symbol_sp s
 T_mv Package_O::intern(SimpleString_sp name) {
   WITH_PACKAGE_READ_WRITE_LOCK(this);
 //  client_validate(name);
-  Symbol_mv values = this->findSymbol_SimpleString_no_lock(name);
+  SymbolNameKey key(name);
+  Symbol_mv values = this->findSymbol_no_lock(key);
 //  client_validate(values->_Name);
   Symbol_sp sym = values;
   Symbol_sp status = gc::As<Symbol_sp>(values.valueGet_(1));
@@ -850,7 +1037,11 @@ T_mv Package_O::intern(SimpleString_sp name) {
     status = _Nil<Symbol_O>();
     sym->setPackage(this->sharedThis<Package_O>());
     LOG(BF("Created symbol<%s>") % _rep_(sym));
-    this->add_symbol_to_package_no_lock(sym->symbolName(), sym, false);
+    if (this->isKeywordPackage() || this->actsLikeKeywordPackage()) {
+      this->_ExternalSymbols.insert(key, sym->symbolName(), sym);
+    } else {
+      this->_InternalSymbols.insert(key, sym->symbolName(), sym);
+    }
   }
   if (this->actsLikeKeywordPackage()) {
     sym->setf_symbolValue(sym);
@@ -889,12 +1080,12 @@ bool Package_O::unintern_no_lock(Symbol_sp sym) {
         this->_Shadowing->remhash(sym);
       }
       if (status == kw::_sym_internal) {
-        this->_InternalSymbols->remhash(nameKey);
+        this->_InternalSymbols.remove(SymbolNameKey(nameKey));
         if (sym->getPackage().get() == this)
           sym->setPackage(_Nil<Package_O>());
         return true;
       } else if (status == kw::_sym_external) {
-        this->_ExternalSymbols->remhash(nameKey);
+        this->_ExternalSymbols.remove(SymbolNameKey(nameKey));
         if (sym->getPackage().get() == this)
           sym->setPackage(_Nil<Package_O>());
         return true;
@@ -931,10 +1122,10 @@ bool Package_O::unintern(Symbol_sp sym) {
 bool Package_O::isExported(Symbol_sp sym) {
   WITH_PACKAGE_READ_LOCK(this);
   SimpleString_sp nameKey = sym->_Name;
-  T_mv values = this->_ExternalSymbols->gethash(nameKey, _Nil<T_O>());
-  T_sp presentp = values.valueGet_(1);
-  LOG(BF("isExported test of symbol[%s] isExported[%d]") % sym->symbolNameAsString() % presentp.isTrue());
-  return (presentp.isTrue());
+  Symbol_sp found;
+  bool presentp = this->_ExternalSymbols.find(SymbolNameKey(nameKey),found);
+  LOG(BF("isExported test of symbol[%s] isExported[%d]") % sym->symbolNameAsString() % presentp);
+  return presentp;
 }
 
 void Package_O::import(List_sp symbols) {
@@ -983,13 +1174,13 @@ List_sp Package_O::shadowingSymbols() const {
 void Package_O::mapExternals(KeyValueMapper *mapper) {
   // I don't know what the caller will do with this so read/write lock
   WITH_PACKAGE_READ_WRITE_LOCK(this);
-  this->_ExternalSymbols->lowLevelMapHash(mapper);
+  this->_ExternalSymbols.map(mapper);
 }
 
 void Package_O::mapInternals(KeyValueMapper *mapper) {
   // I don't know what the caller will do with this so read/write lock
   WITH_PACKAGE_READ_WRITE_LOCK(this);
-  this->_InternalSymbols->lowLevelMapHash(mapper);
+  this->_InternalSymbols.map(mapper);
 }
 
 void Package_O::dumpSymbols() {
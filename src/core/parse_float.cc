@@ -0,0 +1,327 @@
+/*
+    File: parse_float.cc
+*/
+
+/*
+Copyright (c) 2014, Christian E. Schafmeister
+ 
+CLASP is free software; you can redistribute it and/or
+modify it under the terms of the GNU Library General Public
+License as published by the Free Software Foundation; either
+version 2 of the License, or (at your option) any later version.
+ 
+See directory 'clasp/licenses' for full details.
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/* -^- */
+
+#include <clasp/core/foundation.h>
+#include <clasp/core/object.h>
+#include <clasp/core/numbers.h>
+#include <clasp/core/symbolTable.h>
+#include <clasp/core/array.h>
+#include <clasp/core/character.h>
+#include <clasp/core/parse_float.h>
+#include <clasp/core/wrappers.h>
+
+namespace core {
+
+/* ----------------------------------------------------------------------
+ * Decimal to binary conversion (Eisel-Lemire, see Lemire "Number Parsing
+ * at a Gigabyte per Second" 2021).  w*10^q is computed as w times a 128 bit
+ * truncation of 5^q which is enough to get the correctly rounded result
+ * for every 19 digit w, only a truncated mantissa can be ambiguous.
+ */
+
+#define SMALLEST_POWER_OF_FIVE -342
+#define LARGEST_POWER_OF_FIVE 308
+
+struct uint128_parts {
+  uint64_t high;
+  uint64_t low;
+};
+
+/*! 5^q for q in [-342,308] normalized to 128 bits, the top bit set */
+struct PowersOfFive {
+  uint128_parts _Powers[LARGEST_POWER_OF_FIVE - SMALLEST_POWER_OF_FIVE + 1];
+  PowersOfFive() {
+    mpz_class one128 = mpz_class(1) << 128;
+    for (int q = SMALLEST_POWER_OF_FIVE; q <= LARGEST_POWER_OF_FIVE; ++q) {
+      mpz_class p;
+      if (q < 0) {
+        mpz_class power5;
+        mpz_ui_pow_ui(power5.get_mpz_t(), 5, -q);
+        size_t z = mpz_sizeinbase(power5.get_mpz_t(), 2);
+        size_t b = (q >= -27) ? z + 127 : 2 * z + 2 * 64;
+        p = (mpz_class(1) << b) / power5 + 1;
+        while (p >= one128) p >>= 1;
+      } else {
+        mpz_ui_pow_ui(p.get_mpz_t(), 5, q);
+        while (p < (one128 >> 1)) p <<= 1;
+        while (p >= one128) p >>= 1;
+      }
+      mpz_class high = p >> 64;
+      mpz_class low = p - (high << 64);
+      this->_Powers[q - SMALLEST_POWER_OF_FIVE].high = mpz_get_ui_64(high);
+      this->_Powers[q - SMALLEST_POWER_OF_FIVE].low = mpz_get_ui_64(low);
+    }
+  }
+  static uint64_t mpz_get_ui_64(const mpz_class &x) {
+    uint64_t result = 0;
+    mpz_export(&result, NULL, -1, sizeof(result), 0, 0, x.get_mpz_t());
+    return result;
+  }
+};
+
+static const PowersOfFive &powers_of_five() {
+  static PowersOfFive powers;
+  return powers;
+}
+
+/*! The layout of an IEEE binary format */
+struct BinaryFormat {
+  int mantissa_explicit_bits;
+  int minimum_exponent;
+  int infinite_power;
+  int smallest_power_of_ten;
+  int largest_power_of_ten;
+  int min_exponent_round_to_even;
+  int max_exponent_round_to_even;
+  int max_exponent_fast_path;
+};
+
+static const BinaryFormat double_format = {52, -1023, 0x7FF, -342, 308, -4, 23, 22};
+static const BinaryFormat float_format = {23, -127, 0xFF, -65, 38, -17, 10, 10};
+
+/*! The biased binary exponent and the mantissa without the hidden bit,
+    power2 < 0 means the conversion failed */
+struct AdjustedMantissa {
+  uint64_t mantissa;
+  int power2;
+};
+
+static inline uint128_parts full_multiplication(uint64_t a, uint64_t b) {
+  __uint128_t r = (__uint128_t)a * b;
+  uint128_parts result = {(uint64_t)(r >> 64), (uint64_t)r};
+  return result;
+}
+
+static AdjustedMantissa compute_float(const BinaryFormat &binary, int64_t q, uint64_t w) {
+  AdjustedMantissa answer;
+  if (w == 0 || q < binary.smallest_power_of_ten) {
+    answer.power2 = 0;
+    answer.mantissa = 0;
+    return answer;
+  }
+  if (q > binary.largest_power_of_ten) {
+    answer.power2 = binary.infinite_power;
+    answer.mantissa = 0;
+    return answer;
+  }
+  int lz = __builtin_clzll(w);
+  w <<= lz;
+  // Multiply by the top 64 bits of 5^q and only use the next 64 bits
+  // when the bits that decide the rounding could still change
+  const uint128_parts &power = powers_of_five()._Powers[q - SMALLEST_POWER_OF_FIVE];
+  uint64_t precision_mask = 0xFFFFFFFFFFFFFFFFULL >> (binary.mantissa_explicit_bits + 3);
+  uint128_parts product = full_multiplication(w, power.high);
+  if ((product.high & precision_mask) == precision_mask) {
+    uint128_parts second = full_multiplication(w, power.low);
+    product.low += second.high;
+    if (second.high > product.low) product.high++;
+    if (product.low == 0xFFFFFFFFFFFFFFFFULL && (q < -27 || q > 55)) {
+      answer.power2 = -1;
+      return answer;
+    }
+  }
+  int upperbit = (int)(product.high >> 63);
+  int shift = upperbit + 64 - binary.mantissa_explicit_bits - 3;
+  answer.mantissa = product.high >> shift;
+  // (217706*q)>>16 is floor(q*log2(10))
+  answer.power2 = (int)((((152170 + 65536) * q) >> 16) + 63 + upperbit - lz - binary.minimum_exponent);
+  if (answer.power2 <= 0) {
+    // Subnormal
+    if (-answer.power2 + 1 >= 64) {
+      answer.power2 = 0;
+      answer.mantissa = 0;
+      return answer;
+    }
+    answer.mantissa >>= -answer.power2 + 1;
+    answer.mantissa += (answer.mantissa & 1);
+    answer.mantissa >>= 1;
+    answer.power2 = (answer.mantissa < ((uint64_t)1 << binary.mantissa_explicit_bits)) ? 0 : 1;
+    return answer;
+  }
+  // Exactly halfway between two floats - round to even
+  if (product.low <= 1 && q >= binary.min_exponent_round_to_even && q <= binary.max_exponent_round_to_even &&
+      (answer.mantissa & 3) == 1) {
+    if ((answer.mantissa << shift) == product.high) answer.mantissa &= ~(uint64_t)1;
+  }
+  answer.mantissa += (answer.mantissa & 1);
+  answer.mantissa >>= 1;
+  if (answer.mantissa >= ((uint64_t)2 << binary.mantissa_explicit_bits)) {
+    answer.mantissa = (uint64_t)1 << binary.mantissa_explicit_bits;
+    answer.power2++;
+  }
+  answer.mantissa &= ~((uint64_t)1 << binary.mantissa_explicit_bits);
+  if (answer.power2 >= binary.infinite_power) {
+    answer.power2 = binary.infinite_power;
+    answer.mantissa = 0;
+  }
+  return answer;
+}
+
+/*! The bits of dec in the binary format, false if it must be done with bignums */
+static bool decimal_float_bits(const BinaryFormat &binary, const DecimalFloat &dec, uint64_t &bits) {
+  AdjustedMantissa am = compute_float(binary, dec._Exponent, dec._Mantissa);
+  if (am.power2 < 0) return false;
+  if (dec._Truncated) {
+    // The real mantissa lies between w and w+1, if both round the same
+    // so does the real value
+    AdjustedMantissa am1 = compute_float(binary, dec._Exponent, dec._Mantissa + 1);
+    if (am1.power2 != am.power2 || am1.mantissa != am.mantissa) return false;
+  }
+  bits = am.mantissa | ((uint64_t)am.power2 << binary.mantissa_explicit_bits);
+  return true;
+}
+
+static const double exact_powers_of_ten_double[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static const float exact_powers_of_ten_float[] = {
+  1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+bool decimal_float_to_double(const DecimalFloat &dec, double &result) {
+  // The mantissa and the power of ten are exact doubles so a single
+  // rounding gives the right answer
+  if (!dec._Truncated && dec._Mantissa <= ((uint64_t)1 << 53) &&
+      dec._Exponent >= -double_format.max_exponent_fast_path && dec._Exponent <= double_format.max_exponent_fast_path) {
+    double d = (double)dec._Mantissa;
+    if (dec._Exponent < 0) d /= exact_powers_of_ten_double[-dec._Exponent];
+    else d *= exact_powers_of_ten_double[dec._Exponent];
+    result = dec._Negative ? -d : d;
+    return true;
+  }
+  uint64_t bits;
+  if (!decimal_float_bits(double_format, dec, bits)) return false;
+  if (dec._Negative) bits |= (uint64_t)1 << 63;
+  memcpy(&result, &bits, sizeof(result));
+  return true;
+}
+
+bool decimal_float_to_float(const DecimalFloat &dec, float &result) {
+  if (!dec._Truncated && dec._Mantissa <= ((uint64_t)1 << 24) &&
+      dec._Exponent >= -float_format.max_exponent_fast_path && dec._Exponent <= float_format.max_exponent_fast_path) {
+    float f = (float)dec._Mantissa;
+    if (dec._Exponent < 0) f /= exact_powers_of_ten_float[-dec._Exponent];
+    else f *= exact_powers_of_ten_float[dec._Exponent];
+    result = dec._Negative ? -f : f;
+    return true;
+  }
+  uint64_t bits;
+  if (!decimal_float_bits(float_format, dec, bits)) return false;
+  uint32_t bits32 = (uint32_t)bits;
+  if (dec._Negative) bits32 |= (uint32_t)1 << 31;
+  memcpy(&result, &bits32, sizeof(result));
+  return true;
+}
+
+static inline bool float_whitespace(claspCharacter c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+template <typename SimpleType>
+static T_mv parse_float_chars(const SimpleType &chars, String_sp str, size_t offset,
+                              size_t start, size_t end, bool junkAllowed, T_sp type) {
+  size_t cur = start;
+  while (cur < end && float_whitespace(chars[offset + cur])) ++cur;
+  DecimalFloat dec;
+  size_t used = scan_decimal_float(end - cur, [&chars, offset, cur](size_t i) { return (claspCharacter)chars[offset + cur + i]; }, dec);
+  if (used == 0) {
+    if (junkAllowed) return Values(_Nil<T_O>(), make_fixnum(cur));
+    PARSE_ERROR(SimpleBaseString_O::make("Could not parse float from ~S"), Cons_O::create(str, _Nil<T_O>()));
+  }
+  size_t floatStart = cur;
+  cur += used;
+  if (!junkAllowed) {
+    size_t trail = cur;
+    while (trail < end && float_whitespace(chars[offset + trail])) ++trail;
+    if (trail < end) {
+      PARSE_ERROR(SimpleBaseString_O::make("Could not parse float from ~S"), Cons_O::create(str, _Nil<T_O>()));
+    }
+  }
+  T_sp float_format = type;
+  if (float_format.nilp()) {
+    switch (dec._ExponentMarker) {
+    case 's': case 'S':
+      float_format = cl::_sym_ShortFloat_O;
+      break;
+    case 'f': case 'F':
+      float_format = cl::_sym_single_float;
+      break;
+    case 'd': case 'D':
+      float_format = cl::_sym_DoubleFloat_O;
+      break;
+    case 'l': case 'L':
+      float_format = cl::_sym_LongFloat_O;
+      break;
+    default:
+      float_format = cl::_sym_STARreadDefaultFloatFormatSTAR->symbolValue();
+    }
+  }
+  // Only the odd case that needs big arithmetic copies the text
+  std::string text;
+  if (float_format == cl::_sym_single_float || float_format == cl::_sym_ShortFloat_O) {
+    float f;
+    if (!decimal_float_to_float(dec, f)) {
+      for (size_t i = floatStart; i < cur; ++i) text.push_back(isalpha(chars[offset + i]) ? 'e' : (char)chars[offset + i]);
+      f = ::strtof(text.c_str(), NULL);
+    }
+    return Values(clasp_make_single_float(f), make_fixnum(cur));
+  } else if (float_format == cl::_sym_DoubleFloat_O || float_format == cl::_sym_LongFloat_O) {
+    double d;
+    if (!decimal_float_to_double(dec, d)) {
+      for (size_t i = floatStart; i < cur; ++i) text.push_back(isalpha(chars[offset + i]) ? 'e' : (char)chars[offset + i]);
+      d = ::strtod(text.c_str(), NULL);
+    }
+    return Values(DoubleFloat_O::create(d), make_fixnum(cur));
+  }
+  SIMPLE_ERROR(BF("Illegal float format %s") % _rep_(float_format));
+}
+
+CL_LAMBDA(string &key (start 0) end junk-allowed type);
+CL_DECLARE();
+CL_DOCSTRING(R"doc(Parse a decimal float from STRING between START and END, like
+PARSE-INTEGER optionally surrounded by whitespace. TYPE chooses the float
+format, if it is NIL the exponent marker does or *READ-DEFAULT-FLOAT-FORMAT*.
+Return the float and the index where parsing stopped.)doc");
+CL_DEFUN T_mv ext__parse_float(String_sp str, Fixnum start, T_sp end, T_sp junkAllowed, T_sp type) {
+  Fixnum istart = std::max((Fixnum)0, start);
+  Fixnum iend = cl__length(str);
+  if (end.notnilp()) {
+    iend = std::min(iend, unbox_fixnum(gc::As<Fixnum_sp>(end)));
+  }
+  if (istart > iend) istart = iend;
+  AbstractSimpleVector_sp svec;
+  size_t offset, svecEnd;
+  str->asAbstractSimpleVectorRange(svec, offset, svecEnd);
+  if (SimpleBaseString_sp base = svec.asOrNull<SimpleBaseString_O>()) {
+    return parse_float_chars(*base, str, offset, istart, iend, junkAllowed.notnilp(), type);
+  }
+  return parse_float_chars(*gc::As_unsafe<SimpleCharacterString_sp>(svec), str, offset, istart, iend, junkAllowed.notnilp(), type);
+}
+
+SYMBOL_EXPORT_SC_(ExtPkg, parse_float);
+
+};
@@ -379,8 +379,7 @@ CL_DECLARE();
 CL_DOCSTRING("sharp_backslash");
 CL_DEFUN T_mv core__sharp_backslash(T_sp sin, Character_sp ch, T_sp num) {
   SafeBufferStr8Ns sslexemes;
-  List_sp lexemes = collect_lexemes(ch, sin);
-  make_str_preserve_case(sslexemes.string(), lexemes);
+  collect_token_string(ch, sin, sslexemes.string(), true);
   if (!cl::_sym_STARread_suppressSTAR->symbolValue().isTrue()) {
     if (sslexemes.string()->length() == 1 ) {
       return Values(sslexemes.string()->rowMajorAref(0));
@@ -532,9 +531,8 @@ CL_DECLARE();
 CL_DOCSTRING("sharp_colon");
 CL_DEFUN T_mv core__sharp_colon(T_sp sin, Character_sp ch, T_sp num) {
   // CHECKME
-  List_sp lexemes = collect_lexemes(ch, sin);
   SafeBufferStrWNs sslexemes;
-  make_str(sslexemes.string(), lexemes);
+  collect_token_string(ch, sin, sslexemes.string(), false);
   SimpleString_sp lexeme_str = sslexemes.string()->asMinimalSimpleString();
   if (!cl::_sym_STARread_suppressSTAR->symbolValue().isTrue()) {
     Symbol_sp new_symbol = Symbol_O::create(gc::As<SimpleString_sp>(lexeme_str->unsafe_subseq(1,lexeme_str->length())));
@@ -791,6 +789,7 @@ HashTable_sp ReadTable_O::create_standard_syntax_table() {
 ReadTable_sp ReadTable_O::create_standard_readtable() {
   GC_ALLOCATE(ReadTable_O, rt);
   rt->_SyntaxTypes = ReadTable_O::create_standard_syntax_table();
+  rt->refresh_dense_tables();
   ASSERTNOTNULL(_sym_reader_backquoted_expression->symbolFunction());
   ASSERT(_sym_reader_backquoted_expression->symbolFunction().notnilp());
   rt->set_macro_character(clasp_make_standard_character('`'),
@@ -882,6 +881,54 @@ void ReadTable_O::initialize() {
   this->_SyntaxTypes = HashTableEql_O::create_default();
   this->_MacroCharacters = HashTableEql_O::create_default();
   this->_DispatchMacroCharacters = HashTableEql_O::create_default();
+  this->_DenseMacroFunctions = SimpleVector_O::make(READTABLE_DENSE_CHARS, _Nil<T_O>());
+  memset(this->_DenseSyntax, syntax_constituent, READTABLE_DENSE_CHARS);
+}
+
+ReadTableSyntax ReadTable_O::syntax_code_from_symbol(T_sp syntaxType) {
+  if (syntaxType == kw::_sym_constituent) return syntax_constituent;
+  if (syntaxType == kw::_sym_whitespace) return syntax_whitespace;
+  if (syntaxType == kw::_sym_terminating_macro) return syntax_terminating_macro;
+  if (syntaxType == kw::_sym_non_terminating_macro) return syntax_non_terminating_macro;
+  if (syntaxType == kw::_sym_single_escape) return syntax_single_escape;
+  if (syntaxType == kw::_sym_multiple_escape) return syntax_multiple_escape;
+  if (syntaxType == kw::_sym_invalid) return syntax_invalid;
+  SIMPLE_ERROR(BF("Illegal syntax type %s") % _rep_(syntaxType));
+}
+
+Symbol_sp ReadTable_O::syntax_symbol_from_code(ReadTableSyntax code) {
+  switch (code) {
+  case syntax_constituent: return kw::_sym_constituent;
+  case syntax_whitespace: return kw::_sym_whitespace;
+  case syntax_terminating_macro: return kw::_sym_terminating_macro;
+  case syntax_non_terminating_macro: return kw::_sym_non_terminating_macro;
+  case syntax_single_escape: return kw::_sym_single_escape;
+  case syntax_multiple_escape: return kw::_sym_multiple_escape;
+  case syntax_invalid: return kw::_sym_invalid;
+  }
+  SIMPLE_ERROR(BF("Illegal syntax code %d") % (int)code);
+}
+
+ReadTableSyntax ReadTable_O::syntax_code_from_table(claspCharacter c) const {
+  return syntax_code_from_symbol(this->_SyntaxTypes->gethash(clasp_make_character(c), kw::_sym_constituent));
+}
+
+T_sp ReadTable_O::macro_function(claspCharacter c) const {
+  if ((unsigned)c < READTABLE_DENSE_CHARS) return (*this->_DenseMacroFunctions)[c];
+  return this->_MacroCharacters->gethash(clasp_make_character(c), _Nil<T_O>());
+}
+
+void ReadTable_O::refresh_dense_tables() {
+  memset(this->_DenseSyntax, syntax_constituent, READTABLE_DENSE_CHARS);
+  for (size_t i = 0; i < READTABLE_DENSE_CHARS; ++i) (*this->_DenseMacroFunctions)[i] = _Nil<T_O>();
+  this->_SyntaxTypes->maphash([this](T_sp key, T_sp val) {
+      claspCharacter c = clasp_as_claspCharacter(gc::As<Character_sp>(key));
+      if ((unsigned)c < READTABLE_DENSE_CHARS) this->_DenseSyntax[c] = syntax_code_from_symbol(val);
+    });
+  this->_MacroCharacters->maphash([this](T_sp key, T_sp val) {
+      claspCharacter c = clasp_as_claspCharacter(gc::As<Character_sp>(key));
+      if ((unsigned)c < READTABLE_DENSE_CHARS) (*this->_DenseMacroFunctions)[c] = val;
+    });
 }
 
 clasp_readtable_case ReadTable_O::getReadTableCaseAsEnum() {
@@ -909,7 +956,10 @@ Symbol_sp ReadTable_O::setf_readtable_case(Symbol_sp newCase) {
 }
 
 T_sp ReadTable_O::set_syntax_type(Character_sp ch, T_sp syntaxType) {
+  ReadTableSyntax code = syntax_code_from_symbol(syntaxType);
   this->_SyntaxTypes->setf_gethash(ch, syntaxType);
+  claspCharacter c = clasp_as_claspCharacter(ch);
+  if ((unsigned)c < READTABLE_DENSE_CHARS) this->_DenseSyntax[c] = code;
   return _lisp->_true();
 }
 
@@ -925,6 +975,8 @@ T_sp ReadTable_O::set_macro_character(Character_sp ch, T_sp funcDesig, T_sp non_
     TYPE_ERROR(funcDesig,Cons_O::createList(cl::_sym_or,cl::_sym_symbol,cl::_sym_function));
   }
   this->_MacroCharacters->setf_gethash(ch, funcDesig);
+  claspCharacter c = clasp_as_claspCharacter(ch);
+  if ((unsigned)c < READTABLE_DENSE_CHARS) (*this->_DenseMacroFunctions)[c] = funcDesig;
   return _lisp->_true();
 }
 
@@ -936,21 +988,17 @@ string ReadTable_O::__repr__() const {
   return ss.str();
 }
 
-__attribute__((optnone)) Symbol_sp ReadTable_O::syntax_type(Character_sp ch) const {
-  _OF();
-  Symbol_sp result = this->_SyntaxTypes->gethash(ch, kw::_sym_constituent);
-  LOG(BF("character[%s] syntax_type: %s") % _rep_(ch) % _rep_(result));
-  return result;
+Symbol_sp ReadTable_O::syntax_type(Character_sp ch) const {
+  return syntax_symbol_from_code(this->syntax_code(clasp_as_claspCharacter(ch)));
 }
 
 T_mv ReadTable_O::get_macro_character(Character_sp ch) {
-  _OF();
-  T_sp dispatcher = this->_MacroCharacters->gethash(ch, _Nil<T_O>());
-  Symbol_sp syntaxType = this->syntax_type(ch);
-  if (syntaxType == kw::_sym_terminating_macro) {
-    return (Values(dispatcher, _Nil<T_O>()));
-  } else if (syntaxType == kw::_sym_non_terminating_macro) {
-    return (Values(dispatcher, _lisp->_true()));
+  claspCharacter c = clasp_as_claspCharacter(ch);
+  ReadTableSyntax syntaxType = this->syntax_code(c);
+  if (syntaxType == syntax_terminating_macro) {
+    return (Values(this->macro_function(c), _Nil<T_O>()));
+  } else if (syntaxType == syntax_non_terminating_macro) {
+    return (Values(this->macro_function(c), _lisp->_true()));
   }
   return (Values(_Nil<T_O>(), _Nil<T_O>()));
 }
@@ -1034,6 +1082,7 @@ ReadTable_sp ReadTable_O::copyReadTable(gc::Nilable<ReadTable_sp> tdest) {
 		dest->_DispatchMacroCharacters->setf_gethash(key,table);
   });
   dest->_Case = this->_Case;
+  dest->refresh_dense_tables();
   return dest;
 }
 
@@ -0,0 +1,530 @@
+/*
+    File: sampleProfiler.cc
+*/
+
+/*
+Copyright (c) 2018, Christian E. Schafmeister
+
+CLASP is free software; you can redistribute it and/or
+modify it under the terms of the GNU Library General Public
+License as published by the Free Software Foundation; either
+version 2 of the License, or (at your option) any later version.
+
+See directory 'clasp/licenses' for full details.
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/* -^- */
+#include <signal.h>
+#include <errno.h>
+#include <dlfcn.h>
+#include <cxxabi.h>
+#include <sys/time.h>
+#include <sys/mman.h>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <map>
+#include <vector>
+#include <fstream>
+#include <math.h>
+#include <clasp/core/foundation.h>
+#include <clasp/core/object.h>
+#include <clasp/core/lisp.h>
+#include <clasp/core/array.h>
+#include <clasp/core/pathname.h>
+#include <clasp/core/debugger.h>
+#include <clasp/core/sampleProfiler.h>
+#include <clasp/gctools/threadlocal.h>
+#include <clasp/core/wrappers.h>
+
+#if defined(_TARGET_OS_LINUX) && defined(__x86_64__)
+#include <ucontext.h>
+#define SAMPLE_PROFILER_SUPPORTED 1
+#endif
+
+namespace core {
+
+static const size_t SampleMaxDepth = 128;
+static const size_t SampleBufferWords = 1 << 16; // must be a power of two
+static const size_t SampleMaxThreads = 256;
+
+/*! A ring of words with one producer - the SIGPROF handler running on the
+    thread that owns the buffer - and one consumer - the collector thread.
+    Each sample is stored as [depth pc0 ... pc(depth-1)], pc0 being the
+    interrupted pc and the rest return addresses. */
+struct SampleBuffer {
+  std::atomic<size_t> _Head;
+  std::atomic<size_t> _Tail;
+  std::atomic<size_t> _Dropped;
+  uintptr_t           _Words[SampleBufferWords];
+  SampleBuffer() : _Head(0), _Tail(0), _Dropped(0) {};
+
+  void push(const uintptr_t* frames, size_t depth) {
+    size_t head = this->_Head.load(std::memory_order_relaxed);
+    size_t tail = this->_Tail.load(std::memory_order_acquire);
+    if (SampleBufferWords-(head-tail) < depth+1) {
+      this->_Dropped.fetch_add(1,std::memory_order_relaxed);
+      return;
+    }
+    this->_Words[head&(SampleBufferWords-1)] = depth;
+    for ( size_t i=0; i<depth; ++i ) {
+      this->_Words[(head+1+i)&(SampleBufferWords-1)] = frames[i];
+    }
+    this->_Head.store(head+depth+1,std::memory_order_release);
+  }
+
+  size_t drain(std::map<std::vector<uintptr_t>,size_t>& stacks) {
+    size_t tail = this->_Tail.load(std::memory_order_relaxed);
+    size_t head = this->_Head.load(std::memory_order_acquire);
+    size_t samples = 0;
+    std::vector<uintptr_t> stack;
+    while (tail<head) {
+      size_t depth = this->_Words[tail&(SampleBufferWords-1)];
+      stack.resize(depth);
+      for ( size_t i=0; i<depth; ++i ) {
+        stack[i] = this->_Words[(tail+1+i)&(SampleBufferWords-1)];
+      }
+      stacks[stack] += 1;
+      tail += depth+1;
+      ++samples;
+    }
+    this->_Tail.store(tail,std::memory_order_release);
+    return samples;
+  }
+
+  void reset() {
+    this->_Head.store(0);
+    this->_Tail.store(0);
+    this->_Dropped.store(0);
+  }
+};
+
+struct SampleProfiler {
+  std::atomic<bool>       _Running;
+  std::atomic<size_t>     _Session;
+  std::atomic<size_t>     _NextBuffer;
+  std::atomic<size_t>     _DroppedNoBuffer;
+  SampleBuffer*           _Buffers[SampleMaxThreads];
+  bool                    _HandlerInstalled;
+  std::mutex              _StacksMutex;
+  std::map<std::vector<uintptr_t>,size_t> _Stacks;
+  size_t                  _Samples;
+  std::thread             _Collector;
+  std::mutex              _CollectorMutex;
+  std::condition_variable _CollectorWake;
+  bool                    _StopCollector;
+  SampleProfiler() : _Running(false), _Session(0), _NextBuffer(0), _DroppedNoBuffer(0),
+                     _HandlerInstalled(false), _Samples(0), _StopCollector(false) {
+    for ( size_t i=0; i<SampleMaxThreads; ++i ) this->_Buffers[i] = NULL;
+  };
+
+  size_t claimedBuffers() {
+    size_t claimed = this->_NextBuffer.load(std::memory_order_acquire);
+    return (claimed<SampleMaxThreads) ? claimed : SampleMaxThreads;
+  }
+
+  void drainBuffers() {
+    std::lock_guard<std::mutex> guard(this->_StacksMutex);
+    for ( size_t i=0, iEnd(this->claimedBuffers()); i<iEnd; ++i ) {
+      this->_Samples += this->_Buffers[i]->drain(this->_Stacks);
+    }
+  }
+
+  size_t dropped() {
+    size_t dropped = this->_DroppedNoBuffer.load();
+    for ( size_t i=0, iEnd(this->claimedBuffers()); i<iEnd; ++i ) {
+      dropped += this->_Buffers[i]->_Dropped.load();
+    }
+    return dropped;
+  }
+};
+
+SampleProfiler global_SampleProfiler;
+
+/*! The buffer claimed by this thread and the profiling session it was claimed in */
+static THREAD_LOCAL SampleBuffer* my_sample_buffer = NULL;
+static THREAD_LOCAL size_t my_sample_session = 0;
+
+#ifdef SAMPLE_PROFILER_SUPPORTED
+/*! Walk the frame pointer chain from the interrupted context.
+    Clasp and the code it JITs keep frame pointers on Linux; each step is
+    checked against the bounds of this thread's stack so that a frame
+    without a frame pointer ends the walk rather than faulting. */
+static size_t sample_walk_stack(ucontext_t* uc, uintptr_t* frames) {
+  size_t depth = 0;
+  uintptr_t pc = (uintptr_t)uc->uc_mcontext.gregs[REG_RIP];
+  uintptr_t fp = (uintptr_t)uc->uc_mcontext.gregs[REG_RBP];
+  uintptr_t sp = (uintptr_t)uc->uc_mcontext.gregs[REG_RSP];
+  frames[depth++] = pc;
+  gctools::ThreadLocalStateLowLevel* thread = my_thread_low_level;
+  if (!thread) return depth;
+  uintptr_t top = (uintptr_t)thread->_StackTop;
+  while (depth<SampleMaxDepth) {
+    if (fp<sp || fp+2*sizeof(uintptr_t)>top || (fp&(sizeof(uintptr_t)-1))) break;
+    uintptr_t* frame = (uintptr_t*)fp;
+    uintptr_t ret = frame[1];
+    if (ret==0) break;
+    frames[depth++] = ret;
+    uintptr_t next = frame[0];
+    if (next<=fp) break;
+    sp = fp;
+    fp = next;
+  }
+  return depth;
+}
+
+static void sample_profiler_handler(int signo, siginfo_t* info, void* context) {
+  SampleProfiler& profiler = global_SampleProfiler;
+  if (!profiler._Running.load(std::memory_order_acquire)) return;
+  int saved_errno = errno;
+  size_t session = profiler._Session.load(std::memory_order_relaxed);
+  if (my_sample_session != session) {
+    size_t index = profiler._NextBuffer.fetch_add(1);
+    my_sample_buffer = (index<SampleMaxThreads) ? profiler._Buffers[index] : NULL;
+    my_sample_session = session;
+  }
+  SampleBuffer* buffer = my_sample_buffer;
+  if (buffer) {
+    uintptr_t frames[SampleMaxDepth];
+    size_t depth = sample_walk_stack((ucontext_t*)context,frames);
+    buffer->push(frames,depth);
+  } else {
+    profiler._DroppedNoBuffer.fetch_add(1,std::memory_order_relaxed);
+  }
+  errno = saved_errno;
+}
+#endif
+
+static void sample_profiler_collector() {
+  SampleProfiler& profiler = global_SampleProfiler;
+  std::unique_lock<std::mutex> lock(profiler._CollectorMutex);
+  while (!profiler._StopCollector) {
+    profiler._CollectorWake.wait_for(lock,std::chrono::milliseconds(50));
+    profiler.drainBuffers();
+  }
+}
+
+bool sample_profiler_running() {
+  return global_SampleProfiler._Running.load();
+}
+
+void sample_profiler_start(size_t frequency) {
+#ifdef SAMPLE_PROFILER_SUPPORTED
+  SampleProfiler& profiler = global_SampleProfiler;
+  if (profiler._Running.load()) SIMPLE_ERROR(BF("The sampling profiler is already running"));
+  if (frequency==0 || frequency>100000) SIMPLE_ERROR(BF("Illegal sampling frequency %lu - it must be between 1 and 100000 per second") % frequency);
+  if (!profiler._Buffers[0]) {
+    // Reserve address space for every buffer up front - the kernel only
+    // commits the pages of the buffers that threads actually claim.
+    size_t bytes = sizeof(SampleBuffer)*SampleMaxThreads;
+    void* region = mmap(NULL,bytes,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE,-1,0);
+    if (region==MAP_FAILED) SIMPLE_ERROR(BF("Could not allocate %lu bytes for the sampling profiler") % bytes);
+    for ( size_t i=0; i<SampleMaxThreads; ++i ) {
+      profiler._Buffers[i] = new ((char*)region+i*sizeof(SampleBuffer)) SampleBuffer();
+    }
+  }
+  if (!profiler._HandlerInstalled) {
+    struct sigaction action;
+    memset(&action,0,sizeof(action));
+    action.sa_sigaction = sample_profiler_handler;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF,&action,NULL)!=0) SIMPLE_ERROR(BF("Could not install the SIGPROF handler - %s") % strerror(errno));
+    profiler._HandlerInstalled = true;
+  }
+  {
+    std::lock_guard<std::mutex> guard(profiler._StacksMutex);
+    profiler._Stacks.clear();
+    profiler._Samples = 0;
+  }
+  for ( size_t i=0, iEnd(profiler.claimedBuffers()); i<iEnd; ++i ) profiler._Buffers[i]->reset();
+  profiler._NextBuffer.store(0);
+  profiler._DroppedNoBuffer.store(0);
+  profiler._Session.fetch_add(1);
+  profiler._StopCollector = false;
+  // The collector must never take a sample itself - start it with SIGPROF blocked
+  sigset_t block, saved;
+  sigemptyset(&block);
+  sigaddset(&block,SIGPROF);
+  pthread_sigmask(SIG_BLOCK,&block,&saved);
+  profiler._Collector = std::thread(sample_profiler_collector);
+  pthread_sigmask(SIG_SETMASK,&saved,NULL);
+  profiler._Running.store(true,std::memory_order_release);
+  // ITIMER_PROF rather than a timer_create process timer: the kernel sends
+  // the ITIMER_PROF signal to the thread that is using the CPU, a process
+  // wide POSIX timer tends to interrupt the main thread only.
+  struct itimerval timer;
+  size_t interval_usec = 1000000/frequency;
+  timer.it_interval.tv_sec = interval_usec/1000000;
+  timer.it_interval.tv_usec = interval_usec%1000000;
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF,&timer,NULL)!=0) {
+    int err = errno;
+    sample_profiler_stop();
+    SIMPLE_ERROR(BF("Could not start the profiling timer - %s") % strerror(err));
+  }
+#else
+  SIMPLE_ERROR(BF("The sampling profiler is only supported on x86-64 Linux"));
+#endif
+}
+
+size_t sample_profiler_stop() {
+  SampleProfiler& profiler = global_SampleProfiler;
+  if (!profiler._Running.load()) return profiler._Samples;
+  struct itimerval timer;
+  memset(&timer,0,sizeof(timer));
+  setitimer(ITIMER_PROF,&timer,NULL);
+  profiler._Running.store(false,std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> guard(profiler._CollectorMutex);
+    profiler._StopCollector = true;
+  }
+  profiler._CollectorWake.notify_one();
+  profiler._Collector.join();
+  profiler.drainBuffers();
+  return profiler._Samples;
+}
+
+/*! Look up the function containing address: JITted code first, then the
+    symbol tables of the loaded libraries, then dladdr */
+static std::string sample_symbol_name(uintptr_t address) {
+  std::string name;
+  uintptr_t start;
+  size_t size;
+  if (lookup_jitted_object(address,name,start,size)) return name;
+  if (!lookup_library_function(address,name,start)) {
+    Dl_info info;
+    if (dladdr((void*)address,&info)==0 || info.dli_sname==NULL) {
+      stringstream ss;
+      ss << (void*)address;
+      return ss.str();
+    }
+    name = info.dli_sname;
+  }
+  int status;
+  char* demangled = abi::__cxa_demangle(name.c_str(),NULL,NULL,&status);
+  if (demangled) {
+    name = demangled;
+    free(demangled);
+  }
+  return name;
+}
+
+/*! Write one stack in the folded format of stackcollapse.pl - root first,
+    frames separated by ;. The first exact_pcs entries of stack are
+    interrupted pcs, the rest are return addresses. */
+static void write_folded_stack(std::ostream& out, const std::vector<uintptr_t>& stack, size_t exact_pcs, std::map<uintptr_t,std::string>& names) {
+  for ( size_t i=stack.size(); i>0; --i ) {
+    // Return addresses point after the call - back up into the caller
+    uintptr_t address = (i<=exact_pcs) ? stack[i-1] : stack[i-1]-1;
+    auto found = names.find(address);
+    if (found==names.end()) {
+      std::string name = sample_symbol_name(address);
+      for ( auto& c : name ) if (c==';' || c=='\n') c = ':';
+      found = names.insert(std::make_pair(address,name)).first;
+    }
+    out << found->second;
+    if (i>1) out << ';';
+  }
+}
+
+/*! Write one line per unique stack followed by its number of samples */
+static void sample_profiler_write_folded(std::ostream& out) {
+  SampleProfiler& profiler = global_SampleProfiler;
+  std::map<uintptr_t,std::string> names;
+  std::lock_guard<std::mutex> guard(profiler._StacksMutex);
+  for ( auto& entry : profiler._Stacks ) {
+    write_folded_stack(out,entry.first,1,names);
+    out << ' ' << entry.second << '\n';
+  }
+}
+
+CL_LAMBDA(&optional (frequency 997));
+CL_DOCSTRING("Start sampling the call stacks of all running threads FREQUENCY times per second of CPU time. Any earlier samples are discarded.");
+CL_DEFUN void ext__start_profiling(size_t frequency) {
+  sample_profiler_start(frequency);
+}
+
+CL_LAMBDA();
+CL_DOCSTRING("Stop the sampling profiler and return the number of samples collected and the number dropped because a buffer was full.");
+CL_DEFUN T_mv ext__stop_profiling() {
+  size_t samples = sample_profiler_stop();
+  return Values(make_fixnum(samples),make_fixnum(global_SampleProfiler.dropped()));
+}
+
+CL_LAMBDA(pathname);
+CL_DOCSTRING("Write the samples collected by the last profiling run to PATHNAME as folded stacks for flamegraph.pl (see src/profiler/flame). Return the number of samples.");
+CL_DEFUN size_t ext__write_profile(T_sp pathDesig) {
+  if (sample_profiler_running()) SIMPLE_ERROR(BF("Stop the sampling profiler before writing the profile"));
+  string filename = gc::As<String_sp>(cl__namestring(cl__pathname(pathDesig)))->get_std_string();
+  std::ofstream out(filename.c_str());
+  if (!out) SIMPLE_ERROR(BF("Could not open %s to write the profile") % filename);
+  sample_profiler_write_folded(out);
+  return global_SampleProfiler._Samples;
+}
+
+SYMBOL_EXPORT_SC_(ExtPkg,start_profiling);
+SYMBOL_EXPORT_SC_(ExtPkg,stop_profiling);
+SYMBOL_EXPORT_SC_(ExtPkg,write_profile);
+
+
+/*! The allocation sampler.
+    Every thread counts down the bytes it allocates (see
+    GlobalAllocationProfiler::registerAllocation).  While sampling is on the
+    countdowns are drawn from an exponential distribution with a mean of
+    _BytesPerSample, so every byte is equally likely to be sampled and each
+    sample stands for about _BytesPerSample bytes.  A sample records the
+    stamp of the object and the return addresses of the allocating thread. */
+struct AllocationSampler {
+  std::atomic<int64_t> _BytesPerSample; // zero when sampling is off
+  std::atomic<size_t>  _Session;
+  std::mutex           _Mutex;
+  // (stamp . stack) -> (estimated bytes . estimated objects)
+  std::map<std::pair<gctools::stamp_t,std::vector<uintptr_t>>,std::pair<double,double>> _Samples;
+  size_t               _NumberOfSamples;
+  AllocationSampler() : _BytesPerSample(0), _Session(0), _NumberOfSamples(0) {};
+};
+
+AllocationSampler global_AllocationSampler;
+
+static int64_t next_allocation_sample_countdown(gctools::GlobalAllocationProfiler& profiler, int64_t bytes_per_sample) {
+  // xorshift64* - cheap and good enough to randomize the sample points
+  uint64_t x = profiler._SampleRandom;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  profiler._SampleRandom = x;
+  double u = (double)((x*2685821657736338717ULL) >> 11) * (1.0/9007199254740992.0); // [0,1)
+  return (int64_t)(-log(1.0-u)*(double)bytes_per_sample)+1;
+}
+
+/*! Return addresses of the allocating thread, innermost first */
+__attribute__((noinline)) static size_t allocation_walk_stack(uintptr_t* frames) {
+  size_t depth = 0;
+  uintptr_t fp = (uintptr_t)__builtin_frame_address(0);
+  gctools::ThreadLocalStateLowLevel* thread = my_thread_low_level;
+  if (!thread) return depth;
+  uintptr_t top = (uintptr_t)thread->_StackTop;
+  while (depth<SampleMaxDepth) {
+    if (fp+2*sizeof(uintptr_t)>top || (fp&(sizeof(uintptr_t)-1))) break;
+    uintptr_t* frame = (uintptr_t*)fp;
+    uintptr_t ret = frame[1];
+    if (ret==0) break;
+    frames[depth++] = ret;
+    uintptr_t next = frame[0];
+    if (next<=fp) break;
+    fp = next;
+  }
+  return depth;
+}
+
+void allocation_sampler_start(size_t bytes_per_sample) {
+  AllocationSampler& sampler = global_AllocationSampler;
+  if (bytes_per_sample==0) SIMPLE_ERROR(BF("The number of bytes per allocation sample must be positive"));
+  std::lock_guard<std::mutex> guard(sampler._Mutex);
+  sampler._Samples.clear();
+  sampler._NumberOfSamples = 0;
+  sampler._Session.fetch_add(1);
+  sampler._BytesPerSample.store(bytes_per_sample);
+}
+
+size_t allocation_sampler_stop() {
+  AllocationSampler& sampler = global_AllocationSampler;
+  sampler._BytesPerSample.store(0);
+  std::lock_guard<std::mutex> guard(sampler._Mutex);
+  return sampler._NumberOfSamples;
+}
+
+};
+
+namespace gctools {
+__attribute__((noinline)) void sample_allocation(GlobalAllocationProfiler& profiler, stamp_t stamp, size_t size) {
+  core::AllocationSampler& sampler = core::global_AllocationSampler;
+  int64_t bytes_per_sample = sampler._BytesPerSample.load(std::memory_order_relaxed);
+  if (bytes_per_sample==0) {
+    profiler._SampleCountdown = AllocationSampleCheckInterval;
+    return;
+  }
+  size_t session = sampler._Session.load(std::memory_order_relaxed);
+  if (profiler._SampleSession != session) {
+    // This thread just noticed that sampling is on - start a random countdown
+    profiler._SampleSession = session;
+    profiler._SampleCountdown = core::next_allocation_sample_countdown(profiler,bytes_per_sample);
+    return;
+  }
+  uintptr_t frames[core::SampleMaxDepth];
+  size_t depth = core::allocation_walk_stack(frames);
+  // An object of size bytes is sampled with probability 1-exp(-size/bytes_per_sample)
+  double probability = 1.0-exp(-(double)size/(double)bytes_per_sample);
+  double objects = (probability>0.0) ? 1.0/probability : 1.0;
+  {
+    std::lock_guard<std::mutex> guard(sampler._Mutex);
+    std::pair<double,double>& entry = sampler._Samples[std::make_pair(stamp,std::vector<uintptr_t>(frames,frames+depth))];
+    entry.first += objects*(double)size;
+    entry.second += objects;
+    sampler._NumberOfSamples++;
+  }
+  profiler._SampleCountdown = core::next_allocation_sample_countdown(profiler,bytes_per_sample);
+}
+};
+
+namespace core {
+
+static void allocation_sampler_write_folded(std::ostream& out, bool bytes) {
+  AllocationSampler& sampler = global_AllocationSampler;
+  std::map<uintptr_t,std::string> names;
+  std::lock_guard<std::mutex> guard(sampler._Mutex);
+  for ( auto& entry : sampler._Samples ) {
+    const std::vector<uintptr_t>& stack = entry.first.second;
+    write_folded_stack(out,stack,0,names);
+    if (stack.size()>0) out << ';';
+    const char* class_name = obj_name(entry.first.first);
+    out << '[' << (class_name ? class_name : "UNKNOWN") << ']';
+    out << ' ' << (int64_t)(bytes ? entry.second.first : entry.second.second) << '\n';
+  }
+}
+
+CL_LAMBDA(&optional (bytes-per-sample 524288));
+CL_DOCSTRING("Start sampling allocations in all threads - on average one sample every BYTES-PER-SAMPLE bytes allocated. Any earlier samples are discarded.");
+CL_DEFUN void ext__start_allocation_profiling(size_t bytes_per_sample) {
+  allocation_sampler_start(bytes_per_sample);
+}
+
+CL_LAMBDA();
+CL_DOCSTRING("Stop sampling allocations and return the number of samples collected.");
+CL_DEFUN size_t ext__stop_allocation_profiling() {
+  return allocation_sampler_stop();
+}
+
+SYMBOL_EXPORT_SC_(KeywordPkg,bytes);
+SYMBOL_EXPORT_SC_(KeywordPkg,count);
+CL_LAMBDA(pathname &key (weight :bytes));
+CL_DOCSTRING("Write the allocation samples to PATHNAME as folded stacks for flamegraph.pl with the class of the allocated objects as the leaf frame. WEIGHT is :BYTES or :COUNT for the estimated number of bytes or objects allocated along each stack. Return the number of samples.");
+CL_DEFUN size_t ext__write_allocation_profile(T_sp pathDesig, Symbol_sp weight) {
+  if (weight != kw::_sym_bytes && weight != kw::_sym_count) {
+    SIMPLE_ERROR(BF("The allocation profile weight must be :bytes or :count - not %s") % _rep_(weight));
+  }
+  string filename = gc::As<String_sp>(cl__namestring(cl__pathname(pathDesig)))->get_std_string();
+  std::ofstream out(filename.c_str());
+  if (!out) SIMPLE_ERROR(BF("Could not open %s to write the allocation profile") % filename);
+  allocation_sampler_write_folded(out,weight==kw::_sym_bytes);
+  return global_AllocationSampler._NumberOfSamples;
+}
+
+SYMBOL_EXPORT_SC_(ExtPkg,start_allocation_profiling);
+SYMBOL_EXPORT_SC_(ExtPkg,stop_allocation_profiling);
+SYMBOL_EXPORT_SC_(ExtPkg,write_allocation_profile);
+
+};
@@ -193,6 +193,7 @@ Symbol_O::Symbol_O(bool dummy) : _HomePackage(_Nil<T_O>()),
                                  _Function(_Unbound<Function_O>()),
                                  _SetfFunction(_Unbound<Function_O>()),
                                  _Binding(NO_THREAD_LOCAL_BINDINGS),
+                                 _NameHash(0),
                                  _IsSpecial(false),
                                  _IsConstant(false),
                                  _IsMacro(false),
@@ -200,6 +201,7 @@ Symbol_O::Symbol_O(bool dummy) : _HomePackage(_Nil<T_O>()),
 
 Symbol_O::Symbol_O() : Base(),
                        _Binding(NO_THREAD_LOCAL_BINDINGS),
+                       _NameHash(0),
                        _IsSpecial(false),
                        _IsConstant(false),
                        _IsMacro(false),
@@ -229,7 +231,7 @@ Symbol_sp Symbol_O::create_at_boot(const string &nm) {
     THROW_HARD_ERROR(BF("Illegal name for symbol[%s]") % nm);
   }
 #endif
-  n->_Name = SimpleBaseString_O::make(nm.size(),'\0',true,nm.size(),(const claspChar*)nm.c_str());
+  n->setf_name(SimpleBaseString_O::make(nm.size(),'\0',true,nm.size(),(const claspChar*)nm.c_str()));
   return n;
 };
 
@@ -293,15 +295,31 @@ void Symbol_O::setf_plist(List_sp plist) {
   this->_PropertyList = plist;
 }
 
+uint64_t Symbol_O::nameHash() const {
+  uint64_t hash = this->_NameHash;
+  if (hash == 0) {
+    if (SimpleBaseString_sp base = this->_Name.asOrNull<SimpleBaseString_O>()) {
+      hash = hash_string_chars(base->begin(),base->length());
+    } else {
+      SimpleCharacterString_sp wide = gc::As_unsafe<SimpleCharacterString_sp>(this->_Name);
+      hash = hash_string_chars(wide->begin(),wide->length());
+    }
+    // Racing threads compute the same value so a plain store is fine
+    hash |= 1;
+    this->_NameHash = hash;
+  }
+  return hash;
+}
+
 void Symbol_O::sxhash_(HashGenerator &hg) const {
   if (hg.isFilling()) this->_HomePackage.unsafe_general()->sxhash_(hg);
-  if (hg.isFilling()) this->_Name->sxhash_(hg);
+  if (hg.isFilling()) hg.addPart((Fixnum)this->nameHash());
 }
 
 void Symbol_O::sxhash_equal(HashGenerator &hg,LocationDependencyPtrT ld) const
 {
   if (hg.isFilling()) HashTable_O::sxhash_equal(hg,this->_HomePackage,ld);
-  if (hg.isFilling()) HashTable_O::sxhash_equal(hg,this->_Name,ld);
+  if (hg.isFilling()) hg.addPart((Fixnum)this->nameHash());
 }
 
 
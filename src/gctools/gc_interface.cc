@@ -288,6 +288,15 @@ const char *obj_name(gctools::stamp_t stamp) {
 //  printf("%s:%d obj_name stamp= %d  stamp_index = %d\n", __FILE__, __LINE__, stamp, stamp_index);
   return global_stamp_info[stamp_index].name;
 }
+};
+
+namespace gctools {
+size_t allocation_histogram_size() {
+  return (size_t)STAMP_max+2;
+}
+};
+
+extern "C" {
 
 /*! I'm using a format_header so MPS gives me the object-pointer */
 #define GC_DEALLOCATOR_METHOD
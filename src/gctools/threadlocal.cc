@@ -6,6 +6,9 @@
 #include <sys/types.h>
 #include <signal.h>
 #include <execinfo.h>
+#include <mutex>
+#include <set>
+#include <algorithm>
 #include <clasp/core/foundation.h>
 #include <clasp/gctools/threadlocal.h>
 #include <clasp/core/lisp.h>
@@ -191,13 +194,88 @@ void DynamicBindingStack::pop_binding() {
 };
 
 namespace gctools {
+
+/*! Every live thread's allocation counters plus the totals of the threads
+    that have already exited - merged by gctools:allocation-statistics */
+struct AllocationProfilers {
+  std::mutex                           _Mutex;
+  std::set<GlobalAllocationProfiler*>  _Live;
+  std::vector<std::pair<int64_t,int64_t>> _Retired; // bytes, count per stamp
+};
+
+AllocationProfilers& allocationProfilers() {
+  static AllocationProfilers* profilers = new AllocationProfilers();
+  return *profilers;
+}
+
 ThreadLocalStateLowLevel::ThreadLocalStateLowLevel(void* stack_top) :
   _DisableInterrupts(false)
   ,  _StackTop(stack_top)
-{};
+{
+  AllocationProfilers& profilers = allocationProfilers();
+  std::lock_guard<std::mutex> guard(profilers._Mutex);
+  profilers._Live.insert(&this->_Allocations);
+};
 
 ThreadLocalStateLowLevel::~ThreadLocalStateLowLevel()
-{};
+{
+  AllocationProfilers& profilers = allocationProfilers();
+  std::lock_guard<std::mutex> guard(profilers._Mutex);
+  profilers._Live.erase(&this->_Allocations);
+  if (profilers._Retired.size()<this->_Allocations._HistogramSize) {
+    profilers._Retired.resize(this->_Allocations._HistogramSize,std::make_pair(0,0));
+  }
+  for ( size_t i=0; i<this->_Allocations._HistogramSize; ++i ) {
+    profilers._Retired[i].first += this->_Allocations._Histogram[i]._Bytes.load(std::memory_order_relaxed);
+    profilers._Retired[i].second += this->_Allocations._Histogram[i]._Count.load(std::memory_order_relaxed);
+  }
+};
+
+CL_LAMBDA(&optional (all-threads t));
+CL_DOCSTRING("Return a list of (class-name count bytes) for every class of object that was allocated, largest number of bytes first. Only the current thread is counted unless ALL-THREADS is true, in which case the counts of all threads - including those that have exited - are merged.");
+CL_DEFUN core::T_sp gctools__allocation_statistics(core::T_sp all_threads) {
+  std::vector<std::pair<int64_t,int64_t>> totals(allocation_histogram_size(),std::make_pair(0,0));
+  auto add = [&totals] (const GlobalAllocationProfiler& profiler) {
+    for ( size_t i=0; i<profiler._HistogramSize && i<totals.size(); ++i ) {
+      totals[i].first += profiler._Histogram[i]._Bytes.load(std::memory_order_relaxed);
+      totals[i].second += profiler._Histogram[i]._Count.load(std::memory_order_relaxed);
+    }
+  };
+  if (all_threads.notnilp()) {
+    AllocationProfilers& profilers = allocationProfilers();
+    std::lock_guard<std::mutex> guard(profilers._Mutex);
+    for ( auto profiler : profilers._Live ) add(*profiler);
+    for ( size_t i=0; i<profilers._Retired.size() && i<totals.size(); ++i ) {
+      totals[i].first += profilers._Retired[i].first;
+      totals[i].second += profilers._Retired[i].second;
+    }
+  } else {
+    add(my_thread_low_level->_Allocations);
+  }
+  // Several stamps share a name (every stamp past STAMP_max is an instance)
+  std::map<std::string,std::pair<int64_t,int64_t>> named;
+  for ( size_t i=0; i<totals.size(); ++i ) {
+    if (totals[i].second==0) continue;
+    const char* name = obj_name((stamp_t)i);
+    std::pair<int64_t,int64_t>& entry = named[name ? name : "UNKNOWN"];
+    entry.first += totals[i].first;
+    entry.second += totals[i].second;
+  }
+  std::vector<std::pair<std::string,std::pair<int64_t,int64_t>>> sorted(named.begin(),named.end());
+  std::sort(sorted.begin(),sorted.end(),
+            [] (const std::pair<std::string,std::pair<int64_t,int64_t>>& a,
+                const std::pair<std::string,std::pair<int64_t,int64_t>>& b) {
+              return a.second.first < b.second.first;
+            });
+  core::List_sp result = _Nil<core::T_O>();
+  for ( auto& entry : sorted ) {
+    result = core::Cons_O::create(core::Cons_O::createList(core::SimpleBaseString_O::make(entry.first),
+                                                           core::make_fixnum(entry.second.second),
+                                                           core::make_fixnum(entry.second.first)),
+                                  result);
+  }
+  return result;
+}
 
 };
 namespace core {
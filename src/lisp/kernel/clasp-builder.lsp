@@ -5,6 +5,9 @@
   (core:select-package :core))
 
 (defparameter *number-of-jobs* 1)
+(defparameter *use-threaded-build* nil
+  "When true (and the image has threads) a parallel build compiles files on a pool
+of threads in this image rather than in forked children.")
 
 #+(not bclasp cclasp)
 (core:fset 'cmp::with-compiler-timer
@@ -413,15 +416,100 @@ Return files."
            (when (> child-count 0) (go top))))))
   (format t "Leaving compile-system-parallel~%"))
 
+;;; The builder binds these around compile-system; worker threads start out with the
+;;; global values so they have to be passed along explicitly.
+(defparameter *build-thread-specials*
+  '(*package* *readtable* *features* *target-backend* *default-pathname-defaults*
+    *trace-output* cmp::*activation-frame-optimize* core:*defun-inline-hook*))
+
+(defun build-thread-special-bindings ()
+  (let (bindings)
+    (dolist (sym *build-thread-specials*)
+      (when (boundp sym)
+        (push (cons sym (symbol-value sym)) bindings)))
+    ;; The macroexpansion cache is an ordinary hash table - give each thread its own
+    (when (and (boundp 'core:*cache-macroexpand*) core:*cache-macroexpand*)
+      (push (cons 'core:*cache-macroexpand* (make-hash-table :test #'equal)) bindings))
+    bindings))
+
+#+threads
+(defun compile-system-threaded (files &key reload (output-type core:*clasp-build-mode*) (parallel-jobs *number-of-jobs*) batch-min batch-max (file-counter-start 0))
+  "Compile FILES on a pool of PARALLEL-JOBS threads in this image.
+Each thread gets its own LLVMContext (cmp:*llvm-context* is bound per thread) and
+the output of every compile-file is printed in one piece when that file is done.
+With RELOAD the outputs are loaded in the original file order once all are compiled."
+  (declare (ignore batch-min batch-max))
+  (let* ((total (length files))
+         (queue (let ((counter 0))
+                  (mapcar #'(lambda (entry) (cons entry (incf counter))) files)))
+         (queue-lock (mp:make-lock :name 'compile-system-queue))
+         (output-lock (mp:make-lock :name 'compile-system-output))
+         (failures nil)
+         (bindings (build-thread-special-bindings))
+         (stdout *standard-output*))
+    ;; mp:with-lock is not the real thing until mp.lsp is loaded - lock explicitly
+    (labels ((call-with-lock (lock thunk)
+               (mp:lock lock t)
+               (unwind-protect (funcall thunk)
+                 (mp:unlock lock)))
+             (next-job ()
+               (call-with-lock queue-lock #'(lambda () (pop queue))))
+             (report (message output)
+               (call-with-lock
+                output-lock
+                #'(lambda ()
+                    (write-string message stdout)
+                    (with-input-from-string (sin output)
+                      (do ((line (read-line sin nil nil) (read-line sin nil nil)))
+                          ((null line))
+                        (princ "--> " stdout)
+                        (princ line stdout)
+                        (terpri stdout)))
+                    (finish-output stdout))))
+             (compile-one (entry counter)
+               (let* ((condition nil)
+                      (output (with-output-to-string (*standard-output*)
+                                (let ((*error-output* *standard-output*))
+                                  (handler-case
+                                      (compile-kernel-file entry :reload nil :output-type output-type
+                                                                 :counter counter :total-files total
+                                                                 :silent t :verbose t
+                                                                 :file-counter-start file-counter-start)
+                                    (error (c) (setq condition c)))))))
+                 (report (format nil "Finished [~d of ~d] ~a~:[~;  FAILED~] output follows...~%"
+                                 counter total (build-pathname (entry-filename entry) :lisp) condition)
+                         (if condition (format nil "~a~a~%" output condition) output))
+                 (when condition
+                   (call-with-lock queue-lock #'(lambda () (push (cons entry condition) failures))))))
+             (worker ()
+               (do ((job (next-job) (next-job)))
+                   ((null job))
+                 (compile-one (car job) (cdr job)))))
+      (format t "Compiling ~d files on ~d threads~%" total parallel-jobs)
+      (let (workers)
+        (dotimes (i (max 1 (min parallel-jobs total)))
+          (push (mp:process-run-function 'compile-system-worker #'worker bindings) workers))
+        (mapc #'mp:process-join workers))
+      (when failures
+        (error "Could not compile ~{~a~^, ~}" (mapcar #'(lambda (failure) (entry-filename (car failure))) failures)))
+      (when reload
+        (dolist (entry files)
+          (let ((output-path (build-pathname (entry-filename entry) output-type)))
+            (format t "Loading ~a~%" output-path)
+            (load-kernel-file (make-pathname :type "fasl" :defaults output-path) :fasl))))))
+  (format t "Leaving compile-system-threaded~%"))
+
 (defun compile-system (&rest args)
   (let ((compile-function (if (and core:*use-parallel-build* (> *number-of-jobs* 1))
-                              'compile-system-parallel
+                              (if (and *use-threaded-build* (member :threads *features*))
+                                  'compile-system-threaded
+                                  'compile-system-parallel)
                               'compile-system-serial)))
     (format t "Compiling with ~a / core:*use-parallel-build* -> ~a  core:*number-of-jobs* -> ~a~%" compile-function core:*use-parallel-build* *number-of-jobs*)
     
     (apply compile-function args)))
 
-(export '(compile-system-serial compile-system compile-system-parallel))
+(export '(compile-system-serial compile-system compile-system-parallel compile-system-threaded *use-threaded-build*))
 
 ;; Clean out the bitcode files.
 ;; passing :no-prompt t will not prompt the user
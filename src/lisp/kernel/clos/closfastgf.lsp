@@ -775,9 +775,169 @@ It takes the arguments in two forms, as a vaslist and as a list of arguments."
                                         generic-function
                                         :output-path log-output))))
 
+;;; --------------------------------------------------
+;;;
+;;; Tiered dispatch
+;;;   Compiling a dispatcher is expensive and most generic functions see
+;;;   several dispatch misses before their call history settles down.
+;;;   Until then the dtree is interpreted from its compact vector encoding
+;;;   (see cmp:dtree-program) and a dispatcher is only compiled once the
+;;;   call history has been stable for *fastgf-promotion-threshold* calls.
+;;;
+
+(defvar *fastgf-promotion-threshold* 128
+  "The number of calls a generic function must make through the interpreted
+dispatcher, without its call history changing, before a dispatcher is compiled for it.
+NIL or 0 means always compile a dispatcher right away.")
+
+(defun interpreted-dispatch-p ()
+  (let ((threshold *fastgf-promotion-threshold*))
+    (and threshold (> threshold 0))))
+
+;;; The interpreted dispatcher of a generic function is a simple-vector
+;;;   #(call-history specializer-profile program calls)
+;;;   It is only valid while the call-history and specializer-profile are EQ
+;;;   to those of the generic function, so any change to either one
+;;;   builds a new one and starts counting calls again.
+;;;   The call that finds CALLS at or above the threshold resets it to zero
+;;;   and promotes the generic function. If the dispatcher is not installed
+;;;   (the compile failed) promotion is tried again after another threshold
+;;;   calls, and lowering the threshold promotes on the next call.
+;;;   CALLS is incremented without synchronization, so racing calls can lose
+;;;   increments, which only delays promotion, or can both promote before
+;;;   either resets it. A duplicate promotion is queued once or compiles the
+;;;   same dispatcher twice. Calls made while the dispatcher is being
+;;;   compiled keep interpreting.
+;;;   Once the dispatcher is installed the interpreted dispatcher is dropped.
+(defun interpreted-dispatcher (generic-function call-history)
+  (let ((dispatcher (generic-function-interpreted-dispatcher generic-function))
+        (specializer-profile (generic-function-specializer-profile generic-function)))
+    (if (and dispatcher
+             (eq (svref dispatcher 0) call-history)
+             (eq (svref dispatcher 1) specializer-profile))
+        dispatcher
+        (let ((new-dispatcher (vector call-history
+                                      specializer-profile
+                                      (cmp:dtree-program (cmp::calculate-dtree call-history specializer-profile))
+                                      0)))
+          (gf-log "Built interpreted dispatcher for %s%N" (core:function-name generic-function))
+          (generic-function-interpreted-dispatcher-compare-exchange generic-function dispatcher new-dispatcher)
+          new-dispatcher))))
+
+(defun interpreted-dispatch (generic-function call-history valist-args)
+  (let* ((dispatcher (interpreted-dispatcher generic-function call-history))
+         (arguments (core:list-from-va-list valist-args))
+         (outcome (cmp:interpret-dtree-program (svref dispatcher 2) arguments)))
+    (cond
+      ((null outcome)
+       (dispatch-miss generic-function valist-args))
+      (t
+       (let ((threshold *fastgf-promotion-threshold*))
+         (when (or (null threshold) (>= (incf (svref dispatcher 3)) threshold))
+           (setf (svref dispatcher 3) 0)
+           (gf-log "Promoting %s to a compiled dispatcher%N" (core:function-name generic-function))
+           (if (background-compile-p)
+               (enqueue-dispatcher-compile generic-function)
+               (progn
+                 (force-dispatcher generic-function)
+                 (generic-function-interpreted-dispatcher-compare-exchange generic-function dispatcher nil)))))
+       (perform-outcome outcome arguments valist-args)))))
+
+;;; --------------------------------------------------
+;;;
+;;; Background compilation of dispatchers
+;;;   Promoted generic functions are queued for a dispatcher compiler process
+;;;   so that the calling thread never waits for LLVM. Callers keep using the
+;;;   interpreted dispatcher until the compiled one is installed with
+;;;   generic-function-dispatcher-compare-exchange, which refuses to install a
+;;;   dispatcher if the call history changed while it was being compiled.
+;;;
+
+(defvar *fastgf-compile-in-background* #+threads t #-threads nil
+  "If true, dispatchers for promoted generic functions are compiled by a
+background process instead of by the thread that called the generic function.")
+
+(defun background-compile-p ()
+  #+threads *fastgf-compile-in-background*
+  #-threads nil)
+
+(defun compile-and-install-dispatcher (generic-function)
+  "Compile a dispatcher for the current call history of GENERIC-FUNCTION and install it
+if that call history is still current. Return T if it was installed."
+  (let ((call-history (generic-function-call-history generic-function))
+        (specializer-profile (generic-function-specializer-profile generic-function)))
+    (when call-history
+      (install-compiled-dispatcher generic-function
+                                   call-history
+                                   (cmp:codegen-dispatcher call-history
+                                                           specializer-profile
+                                                           generic-function
+                                                           :generic-function-name (core:function-name generic-function))))))
+
+(defun install-compiled-dispatcher (generic-function call-history dispatcher)
+  (when (generic-function-dispatcher-compare-exchange generic-function call-history dispatcher)
+    (loop for interpreted = (generic-function-interpreted-dispatcher generic-function)
+          until (eq (generic-function-interpreted-dispatcher-compare-exchange generic-function interpreted nil) nil))
+    t))
+
+(defun compile-and-install-dispatchers (generic-functions)
+  "Like compile-and-install-dispatcher but the dispatchers are compiled into a single module.
+Return the number of dispatchers that were installed."
+  (loop for (generic-function call-history dispatcher) in (cmp:codegen-dispatchers generic-functions)
+        count (install-compiled-dispatcher generic-function call-history dispatcher)))
+
+#+threads
+(progn
+  (defvar *dispatcher-compile-lock* (mp:make-lock :name '*dispatcher-compile-lock*))
+  (defvar *dispatcher-compile-condition* (mp:make-condition-variable :name '*dispatcher-compile-condition*))
+  ;; Generic functions waiting for a dispatcher, most recent first
+  (defvar *dispatcher-compile-queue* nil)
+  (defvar *dispatcher-compile-process* nil)
+
+  (defun dispatcher-compile-queue-take ()
+    "Wait for and return every queued generic function, oldest first."
+    (unwind-protect
+         (progn
+           (mp:lock *dispatcher-compile-lock* t)
+           (loop while (null *dispatcher-compile-queue*)
+                 do (mp:condition-variable-wait *dispatcher-compile-condition* *dispatcher-compile-lock*))
+           (prog1 (nreverse *dispatcher-compile-queue*)
+             (setf *dispatcher-compile-queue* nil)))
+      (mp:unlock *dispatcher-compile-lock*)))
+
+  (defun dispatcher-compiler-loop ()
+    (loop
+      (let ((generic-functions (dispatcher-compile-queue-take)))
+        ;; Everything that was queued is compiled as one batch. If that fails,
+        ;; compile them one at a time so one bad generic function can't hold back the rest.
+        (handler-case (compile-and-install-dispatchers generic-functions)
+          (error ()
+            (dolist (generic-function generic-functions)
+              (handler-case (compile-and-install-dispatcher generic-function)
+                ;; The generic function keeps using its interpreted dispatcher.
+                (error (err)
+                  (core:bformat *error-output* "Could not compile a dispatcher for %s: %s%N"
+                                (core:function-name generic-function) err)))))))))
+
+  (defun enqueue-dispatcher-compile (generic-function)
+    (unwind-protect
+         (progn
+           (mp:lock *dispatcher-compile-lock* t)
+           (unless *dispatcher-compile-process*
+             (setf *dispatcher-compile-process*
+                   (mp:process-run-function 'dispatcher-compiler #'dispatcher-compiler-loop)))
+           (pushnew generic-function *dispatcher-compile-queue* :test #'eq)
+           (mp:condition-variable-signal *dispatcher-compile-condition*))
+      (mp:unlock *dispatcher-compile-lock*))))
+
+#-threads
+(defun enqueue-dispatcher-compile (generic-function)
+  (compile-and-install-dispatcher generic-function))
+
 (defun invalidated-dispatch-function (generic-function valist-args)
   (declare (optimize (debug 3)))
-  ;;; If there is a call history then compile a dispatch function
+  ;;; If there is a call history then dispatch through the interpreted
+  ;;;   dispatcher until it is time to compile a dispatch function
   ;;;   being extremely careful NOT to use any generic-function calls.
   ;;;   Then redo the call.
   ;;; If there is no call history then treat this like a dispatch-miss.
@@ -787,11 +947,15 @@ It takes the arguments in two forms, as a vaslist and as a list of arguments."
               (core:low-level-standard-generic-function-name generic-function))
       (gf-log "Entered invalidated-dispatch-function - avoiding generic function calls until return!!!%N"))
   (gf-log "Specializer profile is %s%N" (generic-function-specializer-profile generic-function))
-  (if (generic-function-call-history generic-function)
-      (progn
-        (force-dispatcher generic-function)
-        (apply generic-function valist-args))
-      (dispatch-miss generic-function valist-args)))
+  (let ((call-history (generic-function-call-history generic-function)))
+    (cond
+      ((null call-history)
+       (dispatch-miss generic-function valist-args))
+      ((interpreted-dispatch-p)
+       (interpreted-dispatch generic-function call-history valist-args))
+      (t
+       (force-dispatcher generic-function)
+       (apply generic-function valist-args)))))
 
 ;;; I don't believe the following few functions are called from anywhere, but they may be useful for debugging.
 
@@ -907,10 +1071,12 @@ It takes the arguments in two forms, as a vaslist and as a list of arguments."
                                        (gf-log "Writing dispatcher to %s%N" log-output))
                                      (setf log-output (log-cmpgf-filename (generic-function-name gf) "func" "ll")))
                                  (incf-debug-fastgf-didx))
-                 (if edited-call-history
+                 (if (and edited-call-history (not (interpreted-dispatch-p)))
                      (let* ((specializer-profile (generic-function-specializer-profile gf))
                             (discriminating-function (cmp:codegen-dispatcher edited-call-history specializer-profile gf :output-path log-output)))
                        (set-funcallable-instance-function gf discriminating-function))
                      (invalidate-discriminating-function gf)))))))
 
-(export '(invalidate-generic-functions-with-class-selector))
+(export '(invalidate-generic-functions-with-class-selector
+          *fastgf-promotion-threshold*
+          *fastgf-compile-in-background*))
@@ -154,6 +154,8 @@
 (export '(invalidate-generic-functions-with-class-selector
           satiate
           satiate-initialization
+          save-call-histories
+          load-call-histories
           ))
 
 (export '*environment-contains-closure-hook*)
@@ -668,3 +668,131 @@
           standard-direct-slot-definition standard-effective-slot-definition
           eql-specializer method-combination funcallable-standard-class))
        (%satiate make-instances-obsolete (standard-class) (funcallable-standard-class) (structure-class)))))
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;;
+;;; SAVED CALL HISTORIES
+;;;
+;;; A running image learns call histories that the next one has to learn again
+;;; through dispatch misses. SAVE-CALL-HISTORIES writes the class based entries
+;;; of every generic function's call history to a file and LOAD-CALL-HISTORIES
+;;; satiates the generic functions from it, so they start out with those entries.
+;;; Stamps change from one image to the next, so the file only names things:
+;;; each form is (function-name specializers*), where a symbol is written as
+;;; ("PACKAGE" "NAME"), a function name as a symbol or (SETF symbol) and the
+;;; specializers of an entry as a list of class names.
+;;; Entries with EQL specializers or with classes that can't be found by name are skipped.
+
+(defun saved-symbol (symbol)
+  (let ((package (symbol-package symbol)))
+    (when package
+      (list (package-name package) (symbol-name symbol)))))
+
+(defun restored-symbol (saved)
+  (destructuring-bind (package-name symbol-name) saved
+    (let ((package (find-package package-name)))
+      (when package
+        (multiple-value-bind (symbol status) (find-symbol symbol-name package)
+          (when status symbol))))))
+
+(defun saved-function-name (name)
+  (if (consp name)
+      (let ((symbol (saved-symbol (second name))))
+        (when symbol (list 'setf symbol)))
+      (saved-symbol name)))
+
+(defun restored-function-name (saved)
+  (if (eq (first saved) 'setf)
+      (let ((symbol (restored-symbol (second saved))))
+        (when symbol (list 'setf symbol)))
+      (restored-symbol saved)))
+
+(defun saved-call-history-entry (key)
+  "Return the saved form of a call history KEY or NIL if it can't be saved."
+  (loop for specializer across key
+        for name = (and (not (consp specializer)) (class-name specializer))
+        for saved = (and name
+                         (symbolp name)
+                         (eq (find-class name nil) specializer)
+                         (saved-symbol name))
+        if saved collect saved
+          else do (return-from saved-call-history-entry nil)))
+
+(defun call-history-generic-functions ()
+  "Return every generic function that has class based entries in its call history."
+  (let ((generic-functions nil))
+    (dolist (class (subclasses* (find-class 't)))
+      (dolist (generic-function (specializer-call-history-generic-functions class))
+        (pushnew generic-function generic-functions :test #'eq)))
+    generic-functions))
+
+(defun save-call-histories (pathname)
+  "Write the class based call history entries of all generic functions to PATHNAME.
+Return the number of generic functions that were written."
+  (let ((count 0))
+    (with-open-file (stream pathname :direction :output :if-exists :supersede)
+      (with-standard-io-syntax
+        (let ((*package* (find-package "KEYWORD")))
+          (format stream ";;; Call histories saved by CLOS:SAVE-CALL-HISTORIES~%")
+          (dolist (generic-function (call-history-generic-functions))
+            (let ((name (saved-function-name (generic-function-name generic-function)))
+                  (entries (loop for (key . nil) in (generic-function-call-history generic-function)
+                                 for entry = (saved-call-history-entry key)
+                                 when entry collect entry)))
+              (when (and name entries)
+                (incf count)
+                (prin1 (list* name entries) stream)
+                (terpri stream)))))))
+    count))
+
+(defun load-call-histories (pathname &key (compile t))
+  "Satiate generic functions with the call histories saved in PATHNAME by
+SAVE-CALL-HISTORIES. Entries that no longer make sense in this image are skipped.
+If COMPILE is true the dispatchers of all the satiated generic functions are
+compiled together, otherwise they are left to the interpreted dispatcher.
+Return the number of generic functions that were satiated."
+  (let ((satiated nil))
+    (with-open-file (stream pathname :direction :input)
+      (with-standard-io-syntax
+        (let ((*package* (find-package "KEYWORD"))
+              (*read-eval* nil))
+          (loop for form = (read stream nil stream)
+                until (eq form stream)
+                do (let* ((name (restored-function-name (first form)))
+                          (generic-function (and name
+                                                 (fboundp name)
+                                                 (fdefinition name))))
+                     (when (typep generic-function 'generic-function)
+                       (let* ((required (length (generic-function-specializer-profile generic-function)))
+                              (lists (loop for entry in (rest form)
+                                           for classes = (loop for saved in entry
+                                                               for class-name = (restored-symbol saved)
+                                                               for class = (and class-name (find-class class-name nil))
+                                                               if class collect class
+                                                                 else do (return nil))
+                                           when (and classes
+                                                     (= (length classes) required)
+                                                     (applicable-method-list-using-specializers
+                                                      generic-function classes))
+                                             collect classes)))
+                         (when lists
+                           (handler-case
+                               (progn
+                                 (apply #'satiate generic-function lists)
+                                 ;; As dispatch-miss does, so that the entries are
+                                 ;; saved again and dropped when a class is redefined
+                                 (dolist (classes lists)
+                                   (dolist (class classes)
+                                     (core:specializer-call-history-generic-functions-push-new
+                                      class generic-function)))
+                                 (invalidate-discriminating-function generic-function)
+                                 (push generic-function satiated))
+                             (error (err)
+                               (warn "Could not satiate ~s from ~a: ~a" name pathname err)))))))))))
+    (setf satiated (nreverse satiated))
+    (when (and compile satiated)
+      (if (background-compile-p)
+          (dolist (generic-function satiated)
+            (enqueue-dispatcher-compile generic-function))
+          (compile-and-install-dispatchers satiated)))
+    (length satiated)))
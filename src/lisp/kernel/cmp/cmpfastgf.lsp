@@ -377,6 +377,110 @@
 	miss
 	  (no-applicable-method ,vargs)))))
 
+;;; ------------------------------------------------------------
+;;;
+;;; Encode a DTREE as a compact simple-vector that can be
+;;;   interpreted directly - this is the first dispatch tier,
+;;;   used until a generic function is worth compiling a dispatcher for.
+;;;
+;;; Element 0 is the index of the root. Every entry starts with an opcode
+;;;   outcome: +dtree-op-outcome+ outcome
+;;;   skip:    +dtree-op-skip+ next
+;;;   node:    +dtree-op-node+ neql {eql-object next}* nranges {first-stamp last-stamp next}*
+;;; NEXT is the index of the child entry. Each skip or node consumes one argument.
+;;; Ranges are sorted by stamp, exactly as codegen-class-binary-search expects them.
+
+(defconstant +dtree-op-outcome+ 0)
+(defconstant +dtree-op-skip+ 1)
+(defconstant +dtree-op-node+ 2)
+
+(defun dtree-program-emit (node-or-outcome program)
+  "Append NODE-OR-OUTCOME to PROGRAM after its children and return its index."
+  (cond
+    ((outcome-p node-or-outcome)
+     (prog1 (fill-pointer program)
+       (vector-push-extend +dtree-op-outcome+ program)
+       (vector-push-extend (outcome-outcome node-or-outcome) program)))
+    ((skip-node-p node-or-outcome)
+     (let ((next (dtree-program-emit (skip-outcome (first (node-class-specializers node-or-outcome))) program)))
+       (prog1 (fill-pointer program)
+         (vector-push-extend +dtree-op-skip+ program)
+         (vector-push-extend next program))))
+    (t
+     (let ((eql-tests (let (result)
+                        (maphash (lambda (key value)
+                                   (push (cons key (dtree-program-emit value program)) result))
+                                 (node-eql-specializers node-or-outcome))
+                        result))
+           (ranges (mapcar (lambda (match)
+                             (list (range-first-stamp match)
+                                   (range-last-stamp match)
+                                   (dtree-program-emit (match-outcome match) program)))
+                           (node-class-specializers node-or-outcome))))
+       (prog1 (fill-pointer program)
+         (vector-push-extend +dtree-op-node+ program)
+         (vector-push-extend (length eql-tests) program)
+         (loop for (object . next) in eql-tests
+               do (vector-push-extend object program)
+                  (vector-push-extend next program))
+         (vector-push-extend (length ranges) program)
+         (loop for (first-stamp last-stamp next) in ranges
+               do (vector-push-extend first-stamp program)
+                  (vector-push-extend last-stamp program)
+                  (vector-push-extend next program)))))))
+
+(defun dtree-program (dtree)
+  "Return the compact simple-vector encoding of DTREE."
+  (let ((program (make-array 16 :adjustable t :fill-pointer 1)))
+    (setf (aref program 0) (dtree-program-emit (dtree-root dtree) program))
+    (coerce program 'simple-vector)))
+
+(defun dtree-program-search-ranges (program start count stamp)
+  "Binary search COUNT ranges starting at START for STAMP, splitting on the
+first stamp of the right half just like codegen-class-binary-search.
+Return the index of the next entry or NIL."
+  (declare (simple-vector program) (fixnum start count stamp))
+  (loop while (> count 1)
+        do (let* ((half (floor count 2))
+                  (right (+ start (* 3 half))))
+             (if (< stamp (the fixnum (svref program right)))
+                 (setf count half)
+                 (setf start right
+                       count (- count half)))))
+  (when (and (= count 1)
+             (<= (the fixnum (svref program start)) stamp (the fixnum (svref program (1+ start)))))
+    (svref program (+ start 2))))
+
+(defun interpret-dtree-program (program arguments)
+  "Dispatch on the list of ARGUMENTS using PROGRAM (see dtree-program).
+Return the outcome or NIL if this is a dispatch miss."
+  (declare (simple-vector program) (optimize speed))
+  (let ((pc (svref program 0)))
+    (declare (fixnum pc))
+    (loop
+      (let ((op (svref program pc)))
+        (cond
+          ((eql op +dtree-op-outcome+)
+           (return (svref program (1+ pc))))
+          ((null arguments)
+           (return nil))
+          ((eql op +dtree-op-skip+)
+           (setf arguments (cdr arguments)
+                 pc (svref program (1+ pc))))
+          (t
+           (let* ((arg (pop arguments))
+                  (eql-start (+ pc 2))
+                  (ranges-start (+ eql-start (* 2 (the fixnum (svref program (1+ pc)))))))
+             (declare (fixnum eql-start ranges-start))
+             (setf pc (or (loop for index of-type fixnum from eql-start below ranges-start by 2
+                                when (eql arg (svref program index))
+                                  return (svref program (1+ index)))
+                          (dtree-program-search-ranges program
+                                                       (1+ ranges-start)
+                                                       (svref program ranges-start)
+                                                       (core:instance-stamp arg))
+                          (return nil))))))))))
+
 (defun draw-node (fout node)
   (cond
     ((null node)
@@ -890,7 +994,10 @@
         (t (error "codegen-dispatcher was called with an empty call-history - no dispatcher can be generated")))
       dt)))
     
-(defun codegen-dispatcher-from-dtree (generic-function dtree &key (generic-function-name "discriminator") output-path log-gf (debug-on t debug-on-p))
+(defun codegen-dispatcher-from-dtree (generic-function dtree &key (generic-function-name "discriminator") output-path log-gf (debug-on t debug-on-p)
+                                                                  (finish 'jit-add-module-return-dispatch-function))
+  "Generate the dispatcher module and pass it with its functions and literals to FINISH,
+which by default adds it to the JIT and returns the dispatcher."
   (let ((debug-on (if debug-on-p
                       debug-on
                       (core:get-funcallable-instance-debug-on generic-function)))
@@ -1026,18 +1133,38 @@
                 (let ((sorted-roots (gather-sorted-outcomes *eql-selectors* *outcomes*)))
                   (when output-path
                     (debug-save-dispatcher module output-path))
-                  (jit-add-module-return-dispatch-function
-                   module disp-fn startup-fn shutdown-fn sorted-roots))))))))))
+                  (funcall finish module disp-fn startup-fn shutdown-fn sorted-roots))))))))))
 
-(defun codegen-dispatcher (raw-call-history specializer-profile generic-function &rest args &key generic-function-name output-path log-gf (debug-on t debug-on-p))
+(defun codegen-dispatcher (raw-call-history specializer-profile generic-function &rest args &key generic-function-name output-path log-gf (debug-on t debug-on-p) finish)
   (let* ((*log-gf* log-gf)
          (dtree (calculate-dtree raw-call-history specializer-profile)))
     (apply 'codegen-dispatcher-from-dtree generic-function dtree args)))
 
+(defun codegen-dispatchers (generic-functions)
+  "Compile dispatchers for the current call histories of GENERIC-FUNCTIONS and add them
+to the JIT as a single module. Return a list of (generic-function call-history dispatcher)
+for every generic function that had a call history."
+  (let (compiled entries)
+    (dolist (generic-function generic-functions)
+      (let ((call-history (clos:generic-function-call-history generic-function)))
+        (when call-history
+          (codegen-dispatcher call-history
+                              (clos:generic-function-specializer-profile generic-function)
+                              generic-function
+                              :generic-function-name (core:function-name generic-function)
+                              :finish (lambda (&rest entry) (push entry entries)))
+          (push (list generic-function call-history) compiled))))
+    (mapcar (lambda (one dispatcher) (append one (list dispatcher)))
+            (nreverse compiled)
+            (jit-add-modules-return-functions (nreverse entries) :dispatch))))
+
 (export '(make-dtree
 	  dtree-add-call-history
 	  draw-graph
-	  codegen-dispatcher))
+	  dtree-program
+	  interpret-dtree-program
+	  codegen-dispatcher
+	  codegen-dispatchers))
 
 
 
@@ -38,7 +38,7 @@ Return T if disassembly was achieved - otherwise NIL"
     (dolist (llvm-func llvm-function-list)
       (bformat t "%N%s-----%N" (safe-llvm-get-name llvm-func))
       (let* ((llvm-function-name (bformat nil "_%s" (safe-llvm-get-name llvm-func)))
-             (symbol-info (gethash llvm-function-name *jit-saved-symbol-info*)))
+             (symbol-info (llvm-sys:jit-symbol-info llvm-function-name)))
         (if symbol-info
             (let ((bytes (first symbol-info))
                   (address (second symbol-info)))
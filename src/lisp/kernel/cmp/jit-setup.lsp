@@ -613,8 +613,9 @@ The passed module is modified as a side-effect."
 (defvar *jit-log-stream*)
 
 (defun jit-register-symbol (symbol-name-string symbol-info)
-  "This is a callback from llvmoExpose.cc::save_symbol_info for registering JITted symbols"
-  (core:hash-table-setf-gethash *jit-saved-symbol-info* symbol-name-string symbol-info)
+  "This is a callback from llvmoExpose.cc::save_symbol_info for logging JITted symbols.
+It is only called when :jit-log-symbols is on *features* - the symbols themselves
+are kept in a native index, see llvm-sys:jit-symbol-info and llvm-sys:lookup-jit-symbol-info"
   (if (member :jit-log-symbols *features*)
       (unwind-protect
            (progn
@@ -635,7 +636,8 @@ The passed module is modified as a side-effect."
           #+threads(mp:unlock *jit-log-lock*)))))
 
 (progn
-  (export '(jit-add-module-return-function jit-add-module-return-dispatch-function jit-remove-module))
+  (export '(jit-add-module-return-function jit-add-module-return-dispatch-function
+            jit-add-modules-return-functions jit-remove-module))
   (defparameter *jit-lock* (mp:make-lock :name 'jit-lock :recursive t))
   (defun jit-add-module-return-function (original-module main-fn startup-fn shutdown-fn literals-list &optional dispatcher )
     ;; Link the builtins into the module and optimize them
@@ -662,6 +664,60 @@ The passed module is modified as a side-effect."
 
   (defun jit-add-module-return-dispatch-function (original-module dispatch-fn startup-fn shutdown-fn literals-list)
     (jit-add-module-return-function original-module dispatch-fn startup-fn shutdown-fn literals-list :dispatch))
+
+  ;;; Linking in the builtins, optimizing and adding a module to the JIT cost the
+  ;;;   same for a tiny dispatcher as for a big function, so when many are compiled
+  ;;;   at once they are linked into one module and pay that cost only once.
+  (defun batch-unique-name (fn names)
+    "Rename FN if another function in the batch already uses its name and return the name."
+    (when fn
+      (let* ((name (llvm-sys:get-name fn))
+             (count (gethash name names 0)))
+        (setf (gethash name names) (1+ count))
+        (if (zerop count)
+            name
+            (let ((unique-name (bformat nil "%s.%d" name count)))
+              (llvm-sys:set-name fn unique-name)
+              unique-name)))))
+
+  (defun jit-add-modules-return-functions (entries &optional dispatcher)
+    "Each of ENTRIES is a list of the module, main-fn, startup-fn, shutdown-fn and literals-list
+that would be passed to jit-add-module-return-function. Link all of the modules into one,
+link the builtins into it once, optimize it and add it to the JIT once.
+Return a list of the functions in the same order as ENTRIES."
+    (when (null (rest entries))
+      (return-from jit-add-modules-return-functions
+        (mapcar (lambda (entry)
+                  (destructuring-bind (module main-fn startup-fn shutdown-fn literals-list) entry
+                    (jit-add-module-return-function module main-fn startup-fn shutdown-fn literals-list dispatcher)))
+                entries)))
+    (let* ((module (create-run-time-module-for-compile))
+           (linker (llvm-sys:make-linker module))
+           (names (make-hash-table :test #'equal))
+           (finalize (loop for (entry-module main-fn startup-fn shutdown-fn literals-list) in entries
+                           collect (list (batch-unique-name main-fn names)
+                                         (or (batch-unique-name startup-fn names) "")
+                                         (or (batch-unique-name shutdown-fn names) "")
+                                         literals-list)
+                           ;; This invalidates the llvm-sys:function objects in entry-module
+                           do (multiple-value-bind (failed message)
+                                  (llvm-sys:link-in-module linker entry-module)
+                                (when failed
+                                  (error "Could not link a module into a jit batch: ~a" message))))))
+      (if dispatcher
+          (link-inline-remove-fastgf module)
+          (link-inline-remove-builtins module))
+      (let ((jit-engine (jit-engine)))
+        (with-track-llvm-time
+            (unwind-protect
+                 (progn
+                   (mp:lock *jit-lock* t)
+                   (let ((handle (llvm-sys:clasp-jit-add-module jit-engine module)))
+                     (loop for (main-name startup-name shutdown-name literals-list) in finalize
+                           collect (llvm-sys:jit-finalize-repl-function jit-engine handle
+                                                                         main-name startup-name shutdown-name
+                                                                         literals-list))))
+              (mp:unlock *jit-lock*))))))
      
   (defun jit-remove-module (handle)
     (llvm-sys:clasp-jit-remove-module (jit-engine) handle))
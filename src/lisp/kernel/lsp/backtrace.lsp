@@ -28,23 +28,17 @@
 
 
 (defun dump-jit-symbol-info ()
-  (maphash (lambda (key value)
-             (let ((func-size (first value))
-                   (func-start (second value)))
-               (bformat t "%s -> %s %s%N" key func-start func-size)))
-           cmp::*jit-saved-symbol-info*)
+  (core:dump-jitted-objects)
   (values))
 
 
 ;;; Use a return address to identify the JITted function that contains it
 (defun locate-jit-symbol-info (address)
-  (maphash (lambda (key value)
-             (let ((func-size (first value))
-                   (func-start (second value)))
-               (if (core:pointer-in-pointer-range address func-start func-size)
-                   (return-from locate-jit-symbol-info (values key func-start func-size)))))
-           cmp::*jit-saved-symbol-info*)
-  (values))
+  (let ((info (llvm-sys:lookup-jit-symbol-info address)))
+    (if info
+        (destructuring-bind (name func-size func-start) info
+          (values name func-start func-size))
+        (values))))
 
 (defun ensure-function-name (name)
   "Return a symbol or cons that can be used as a function name in a backtrace.
@@ -47,6 +47,34 @@
 
 (export '(with-locked-hash-table))
 
+
+(defmacro with-profiling ((&key (frequency 997) (pathname "/tmp/clasp-profile.folded")) &body body)
+  "Sample the call stacks of every thread FREQUENCY times per second of CPU time
+while BODY runs and write them to PATHNAME as folded stacks.
+Make a flame graph with src/profiler/flame PATHNAME"
+  `(progn
+     (start-profiling ,frequency)
+     (unwind-protect
+          (progn ,@body)
+       (stop-profiling)
+       (write-profile ,pathname))))
+
+(defmacro with-allocation-profiling ((&key (bytes-per-sample 524288)
+                                           (pathname "/tmp/clasp-allocations.folded")
+                                           (weight :bytes))
+                                     &body body)
+  "Sample the allocations of every thread, on average once every BYTES-PER-SAMPLE
+bytes, while BODY runs and write them to PATHNAME as folded stacks.
+WEIGHT is :BYTES or :COUNT. Make a flame graph with src/profiler/flame PATHNAME"
+  `(progn
+     (start-allocation-profiling ,bytes-per-sample)
+     (unwind-protect
+          (progn ,@body)
+       (stop-allocation-profiling)
+       (write-allocation-profile ,pathname :weight ,weight))))
+
+(export '(with-profiling with-allocation-profiling))
+
 (in-package :cl)
 
 (defmacro unwind-protect (protected-form &rest cleanup-forms)
@@ -243,41 +243,16 @@ the corresponding VAR.  Returns NIL."
 
 
 (defun hash-table-iterator (hash-table)
-  (let ((number-of-buckets (hash-table-number-of-hashes hash-table))
-        (buckets (core:hash-table-buckets hash-table))
-        (hash 0)
-        cur-alist)
-    (labels ((advance-hash-table-iterator ()
-               (declare (core:lambda-name advance-hash-table-iterator))
-               (tagbody
-                top
-                  (if cur-alist
-                      (progn
-                        (setq cur-alist (cdr cur-alist))
-                        (if cur-alist
-                            (progn
-                              (when (core:hash-table-entry-deleted-p (car cur-alist))
-                                (go top)))
-                            (progn
-                              (setq hash (1+ hash))
-                              (go top))))
-                      (if (< hash number-of-buckets)
-                          (progn
-                            (setq cur-alist (elt buckets hash))
-                            (if cur-alist
-                                (progn
-                                  (when (core:hash-table-entry-deleted-p (car cur-alist))
-                                    (go top)))
-                                (progn
-                                  (setq hash (1+ hash))
-                                  (go top)))))))))
-      (function (lambda ()
-        (if (>= hash number-of-buckets)
-            nil
-            (progn
-              (advance-hash-table-iterator)
-              (when (< hash number-of-buckets)
-                (values t (caar cur-alist) (cdar cur-alist))))))))))
+  (let ((index 0))
+    (function (lambda ()
+      (multiple-value-call
+          (function (lambda (&optional next-index key value)
+            (if next-index
+                (progn
+                  (setq index next-index)
+                  (values t key value))
+                nil)))
+        (core:hash-table-next-entry hash-table index))))))
 
 ;   "Substitute data of ALIST for subtrees matching keys of ALIST."
 (defun sublis (alist tree &key key (test #'eql) test-not)
@@ -29,51 +29,54 @@ is used."
 		      nil)))
 	    (list-all-packages))))
 
+(defun package-symbol-list (package kind)
+  (let ((symbols nil))
+    (core:map-package-symbols #'(lambda (s) (push s symbols)) package kind)
+    symbols))
+
 (defun packages-iterator (packages options maybe-list)
   (let ((all-symbols nil))
     (when (or (atom packages) (not maybe-list))
       (setq packages (list packages)))
+    ;; Each entry is (package type source); the symbols of SOURCE are
+    ;; only collected when the iterator reaches the entry.
     (dolist (p packages)
       (let ((package (si::coerce-to-package p)))
-	(multiple-value-bind (hash-ext hash-int packages-used)
-	    (si::package-hash-tables package)
-	  (when (member :external options)
-	    (push (list package :external hash-ext) all-symbols))
-	  (when (member :internal options)
-	    (push (list package :internal hash-int) all-symbols))
-	  (when (member :inherited options)
-	    (dolist (p packages-used)
-	      (push (list package :inherited (si::package-hash-tables p))
-		    all-symbols))))))
+	(when (member :external options)
+	  (push (list package :external package) all-symbols))
+	(when (member :internal options)
+	  (push (list package :internal package) all-symbols))
+	(when (member :inherited options)
+	  (dolist (p (package-use-list package))
+	    (push (list package :inherited p) all-symbols)))))
     (unless all-symbols
       (return-from packages-iterator #'(lambda () (values nil nil nil nil))))
     (let* ((current (pop all-symbols))
 	   (package (first current))
 	   (type (second current))
-	   (iterator (si::hash-table-iterator (third current))))
+	   (symbols (package-symbol-list (third current)
+                                         (if (eq type :internal) :internal :external))))
       (flet ((iterate ()
                (declare (core:lambda-name packages-iterator-iterate))
 	       (tagbody
 		AGAIN
-		  (multiple-value-bind (found key value)
-		      (funcall iterator)
-		    (declare (ignore key))
-		    (cond 
-		      (found
+		  (cond
+		    (symbols
+		     (let ((value (pop symbols)))
 		       (when (eq type :inherited)
 			 (multiple-value-bind (s access)
 			     (find-symbol (symbol-name value) package)
 			   (unless (and (eq s value) (eq access type))
 			     (go AGAIN))))
-		       (return-from iterate (values t value type package)))
-		      ((null all-symbols)
-		       (return-from iterate (values nil nil nil nil)))
-		      (t
-		       (setq current (pop all-symbols))
-		       (setq package (first current)
-			     type (second current)
-			     iterator (si::hash-table-iterator (third current))
-			     ))))
+		       (return-from iterate (values t value type package))))
+		    ((null all-symbols)
+		     (return-from iterate (values nil nil nil nil)))
+		    (t
+		     (setq current (pop all-symbols))
+		     (setq package (first current)
+			   type (second current)
+			   symbols (package-symbol-list (third current)
+                                                        (if (eq type :internal) :internal :external)))))
 		  (go AGAIN))))
 	#'iterate))))
 
@@ -46,6 +46,16 @@
 (defun test-error()
   (error "both test and test-not are supplied"))
 
+;;; COUNT, FIND and POSITION of a bit in a simple-bit-vector with the
+;;; default test scan the vector a word at a time in C++.
+(defun simple-bit-vector-item-p (item sequence test test-not key)
+  (and (simple-bit-vector-p sequence)
+       (or (eql item 0) (eql item 1))
+       (null test-not)
+       ;; WITH-KEY has already replaced a null key with #'identity
+       (or (null key) (eq key #'identity))
+       (or (null test) (eq test 'eql) (eq test #'eql))))
+
 (defun unsafe-funcall1 (f x)
   (declare (function f)
 	   (optimize (speed 3) (safety 0)))
@@ -328,6 +338,8 @@
   (with-tests (test test-not key)
     (declare (optimize (speed 3) (safety 0) (debug 0)))
     (with-start-end (start end sequence l)
+      (when (simple-bit-vector-item-p item sequence test test-not key)
+        (return-from count (bit-vector-count sequence item start end)))
       (let ((counter 0))
 	(declare (fixnum counter))
 	(if from-end
@@ -418,6 +430,8 @@
     (declare (optimize (speed 3) (safety 0) (debug 0)))
     (with-start-end (start end sequence length)
       (declare (ignore length))
+      (when (simple-bit-vector-item-p item sequence test test-not key)
+        (return-from find (and (bit-vector-position sequence item start end from-end) item)))
       (let ((output nil))
         (do-sequence (elt sequence start end
                           :output output :index index :specialize t)
@@ -441,6 +455,8 @@
   (with-tests (test test-not key)
     (declare (optimize (speed 3) (safety 0) (debug 0)))
     (with-start-end (start end sequence)
+      (when (simple-bit-vector-item-p item sequence test test-not key)
+        (return-from position (bit-vector-position sequence item start end from-end)))
       (let ((output nil))
         (do-sequence (elt sequence start end
                       :output output :index index :specialize t)
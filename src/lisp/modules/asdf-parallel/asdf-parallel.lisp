@@ -0,0 +1,195 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;
+;; Compile the files of an ASDF system on a pool of threads.
+;;
+;; A file is handed to a worker as soon as every file it depends on
+;; (its :depends-on, its enclosing modules' :depends-on and, for
+;; :serial modules, the files before it) has been compiled and loaded.
+;; Each worker thread has its own LLVMContext so the compiles share
+;; nothing but the image itself.  Loading stays on the calling thread.
+;; Systems the system depends on are loaded first with ASDF:LOAD-SYSTEM.
+;;
+;;   (require :asdf-parallel)
+;;   (asdf-parallel:parallel-load-system :my-system :jobs 16)
+;; or
+;;   (asdf:operate 'asdf-parallel:parallel-load-op :my-system)
+;;
+;; Files that only depend on each other through a :serial module
+;; compile one after the other - there is nothing to overlap.
+;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+(eval-when (:compile-toplevel :load-toplevel :execute)
+  (require :asdf))
+
+(defpackage "ASDF-PARALLEL"
+  (:use "CL")
+  (:export "PARALLEL-LOAD-OP" "PARALLEL-LOAD-SYSTEM" "*JOBS*"))
+
+(in-package "ASDF-PARALLEL")
+
+(defvar *jobs* (core:num-logical-processors)
+  "The number of compile-file threads PARALLEL-LOAD-SYSTEM uses by default.")
+
+;;; One file of the system and what it is waiting for.
+(defstruct (job (:constructor make-job (component input output)))
+  component input output
+  (dependencies nil)
+  (state :waiting)                      ; :waiting :compiling :loaded
+  (recompiled nil)
+  ;; Set by the worker: (warnings-p failure-p) or the error it hit
+  (result nil))
+
+(defun component-files (component)
+  "The source files in COMPONENT (a file or a module)."
+  (if (typep component 'asdf:parent-component)
+      (loop for child in (asdf:component-children component)
+            append (component-files child))
+      (when (typep component 'asdf:cl-source-file)
+        (list component))))
+
+(defun sideway-dependency-files (component)
+  "The source files COMPONENT depends on, directly or through its parents."
+  (loop for c = component then (asdf:component-parent c)
+        for parent = (asdf:component-parent c)
+        while parent
+        append (loop for spec in (asdf:component-sideway-dependencies c)
+                     for dependency = (asdf:resolve-dependency-spec parent spec)
+                     when dependency
+                       append (component-files dependency))))
+
+(defun system-jobs (system)
+  (let* ((operation (asdf:make-operation 'asdf:compile-op))
+         (jobs (loop for component in (asdf:required-components system
+                                                                :other-systems nil
+                                                                :component-type 'asdf:cl-source-file
+                                                                :goal-operation 'asdf:load-op)
+                     collect (make-job component
+                                       (first (asdf:input-files operation component))
+                                       (first (asdf:output-files operation component)))))
+         (table (make-hash-table :test #'eq)))
+    (dolist (job jobs)
+      (setf (gethash (job-component job) table) job))
+    (dolist (job jobs)
+      (setf (job-dependencies job)
+            (remove-duplicates
+             (loop for file in (sideway-dependency-files (job-component job))
+                   for dependency = (gethash file table)
+                   when dependency collect dependency))))
+    jobs))
+
+(defun up-to-date-p (job)
+  (and (notany #'job-recompiled (job-dependencies job))
+       (probe-file (job-output job))
+       (>= (file-write-date (job-output job)) (file-write-date (job-input job)))))
+
+(defun compile-job (job)
+  "Run compile-file for JOB. This is the only part that runs on a worker thread."
+  (let ((component (job-component job)))
+    (setf (job-result job)
+          (handler-case
+              (multiple-value-bind (output warnings-p failure-p)
+                  (uiop:call-around-hook
+                   (asdf:around-compile-hook component)
+                   (lambda (&rest flags)
+                     (apply #'uiop:compile-file* (job-input job)
+                            :output-file (job-output job)
+                            :external-format (asdf:component-external-format component)
+                            flags)))
+                (list output warnings-p failure-p))
+            (error (condition) condition)))))
+
+(defun parallel-load-system (system &key (jobs *jobs*) force)
+  "Compile and load SYSTEM, compiling independent files on up to JOBS threads.
+With FORCE every file is recompiled."
+  (let* ((system (asdf:find-system system))
+         (lock (mp:make-lock :name 'parallel-load-system))
+         (condition-variable (mp:make-condition-variable :name 'parallel-load-system))
+         (queue nil)
+         (finished nil)
+         (stop nil)
+         (bindings (list (cons '*package* *package*)
+                         (cons '*readtable* *readtable*)
+                         (cons '*features* *features*)
+                         (cons '*default-pathname-defaults* *default-pathname-defaults*)))
+         (load-op (asdf:make-operation 'asdf:load-op))
+         (compile-op (asdf:make-operation 'asdf:compile-op)))
+    (dolist (spec (asdf:component-sideway-dependencies system))
+      (let ((dependency (asdf:resolve-dependency-spec system spec)))
+        (when dependency (asdf:load-system dependency))))
+    (let* ((all-jobs (system-jobs system))
+           (pending (length all-jobs))
+           (workers
+             (loop repeat (max 1 (min jobs pending))
+                   collect (mp:process-run-function
+                            'parallel-compile-worker
+                            (lambda ()
+                              (loop
+                                (let ((job (mp:with-lock (lock)
+                                             (loop while (and (null queue) (not stop))
+                                                   do (mp:condition-variable-wait condition-variable lock))
+                                             (pop queue))))
+                                  (unless job (return))
+                                  (compile-job job)
+                                  (mp:with-lock (lock)
+                                    (push job finished)
+                                    (mp:condition-variable-broadcast condition-variable)))))
+                            bindings))))
+      (flet ((load-job (job)
+               (asdf:perform load-op (job-component job))
+               (asdf:mark-operation-done compile-op (job-component job))
+               (asdf:mark-operation-done load-op (job-component job))
+               (setf (job-state job) :loaded)
+               (decf pending))
+             (check-job (job)
+               (let ((result (job-result job)))
+                 (when (typep result 'condition)
+                   (error result))
+                 (destructuring-bind (output warnings-p failure-p) result
+                   (uiop:check-lisp-compile-results output warnings-p failure-p
+                                                    "compiling ~a" (list (job-input job)))))))
+        (unwind-protect
+             (loop while (> pending 0)
+                   do (let ((progress nil))
+                        ;; Start everything whose dependencies are loaded; files that are
+                        ;; already up to date are loaded right away, which may free up more.
+                        (dolist (job all-jobs)
+                          (when (and (eq (job-state job) :waiting)
+                                     (every (lambda (dependency) (eq (job-state dependency) :loaded))
+                                            (job-dependencies job)))
+                            (setf progress t)
+                            (if (and (not force) (up-to-date-p job))
+                                (load-job job)
+                                (progn
+                                  (setf (job-state job) :compiling
+                                        (job-recompiled job) t)
+                                  (mp:with-lock (lock)
+                                    (setf queue (append queue (list job)))
+                                    (mp:condition-variable-broadcast condition-variable))))))
+                        (unless progress
+                          (let ((done (mp:with-lock (lock)
+                                        (loop while (null finished)
+                                              do (mp:condition-variable-wait condition-variable lock))
+                                        (prog1 (nreverse finished)
+                                          (setf finished nil)))))
+                            (dolist (job done)
+                              (check-job job)
+                              (load-job job))))))
+          (mp:with-lock (lock)
+            (setf stop t
+                  queue nil)
+            (mp:condition-variable-broadcast condition-variable))
+          (mapc #'mp:process-join workers))))
+    ;; Everything is on disk and loaded now; let ASDF do its own bookkeeping.
+    (asdf:load-system system)
+    system))
+
+(defclass parallel-load-op (asdf:non-propagating-operation)
+  ()
+  (:documentation "Compile and load a system with PARALLEL-LOAD-SYSTEM."))
+
+(defmethod asdf:perform ((operation parallel-load-op) (system asdf:system))
+  (parallel-load-system system))
+
+(defmethod asdf:perform ((operation parallel-load-op) (component asdf:component))
+  nil)
@@ -0,0 +1,46 @@
+(in-package #:clasp-tests)
+
+(eval-when (:compile-toplevel :load-toplevel :execute)
+  (require :asdf-parallel))
+
+;;; A four file system with a diamond of dependencies: b and c can
+;;; compile side by side once a is loaded, d waits for both.
+(defparameter *asdf-parallel-test-files*
+  '(("a" "(defpackage \"ASDF-PARALLEL-TEST\" (:use \"CL\"))
+(in-package \"ASDF-PARALLEL-TEST\")
+(defun a () 1)")
+    ("b" "(in-package \"ASDF-PARALLEL-TEST\")
+(defun b () (+ (a) 10))")
+    ("c" "(in-package \"ASDF-PARALLEL-TEST\")
+(defun c () (+ (a) 100))")
+    ("d" "(in-package \"ASDF-PARALLEL-TEST\")
+(defun d () (+ (b) (c)))")
+    ("asdf-parallel-test.asd" "(asdf:defsystem \"asdf-parallel-test\"
+  :components ((:file \"a\")
+               (:file \"b\" :depends-on (\"a\"))
+               (:file \"c\" :depends-on (\"a\"))
+               (:file \"d\" :depends-on (\"b\" \"c\"))))")))
+
+(defun write-asdf-parallel-test-system (dir)
+  (ensure-directories-exist dir)
+  (loop for (name contents) in *asdf-parallel-test-files*
+        for file = (if (pathname-type name)
+                       (merge-pathnames name dir)
+                       (merge-pathnames (make-pathname :name name :type "lisp") dir))
+        do (with-open-file (out file :direction :output :if-exists :supersede)
+             (write-string contents out)
+             (terpri out))))
+
+(test asdf-parallel-1
+      (let ((dir (pathname (format nil "/tmp/clasp-regression-asdf-parallel-~d-~d/"
+                                   (core:getpid) (get-universal-time)))))
+        (unwind-protect
+             (progn
+               (write-asdf-parallel-test-system dir)
+               (asdf:load-asd (merge-pathnames "asdf-parallel-test.asd" dir))
+               (asdf-parallel:parallel-load-system "asdf-parallel-test" :jobs 2 :force t)
+               (= (funcall (find-symbol "D" "ASDF-PARALLEL-TEST")) 112))
+          (ignore-errors
+           (asdf:clear-system "asdf-parallel-test")
+           (mapc #'delete-file (directory (merge-pathnames "*.*" dir)))
+           (core:rmdir (namestring dir))))))
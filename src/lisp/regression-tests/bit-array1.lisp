@@ -154,3 +154,49 @@
 
 
 
+;;; Word at a time kernels with ranges that don't start on a word boundary
+(test bit-array-unaligned-1
+      (let* ((n 300)
+             (x (make-array n :element-type 'bit))
+             (y (make-array n :element-type 'bit)))
+        (dotimes (i n)
+          (setf (sbit x i) (if (zerop (mod (* i 7) 3)) 1 0)
+                (sbit y i) (if (zerop (mod (* i 5) 4)) 1 0)))
+        (loop for (xo yo ro len) in '((0 0 0 300) (3 0 0 200) (0 33 5 250) (31 1 64 170) (17 45 2 99))
+              always (let* ((dx (make-array len :element-type 'bit :displaced-to x :displaced-index-offset xo))
+                            (dy (make-array len :element-type 'bit :displaced-to y :displaced-index-offset yo))
+                            (r (make-array n :element-type 'bit :initial-element 1))
+                            (dr (make-array len :element-type 'bit :displaced-to r :displaced-index-offset ro)))
+                       (bit-xor dx dy dr)
+                       (and (loop for i below len
+                                  always (= (bit dr i) (logxor (bit dx i) (bit dy i))))
+                            (loop for i below ro always (= (sbit r i) 1))
+                            (loop for i from (+ ro len) below n always (= (sbit r i) 1))
+                            (equal (bit-andc1 dx dy)
+                                   (map 'bit-vector (lambda (a b) (logandc1 a b)) dx dy)))))))
+
+(test bit-vector-scan-1
+      (let ((v (make-array 1000 :element-type 'bit :initial-element 0)))
+        (setf (sbit v 77) 1 (sbit v 500) 1 (sbit v 999) 1)
+        (and (= (count 1 v) 3)
+             (= (count 0 v) 997)
+             (= (count 1 v :start 78 :end 999) 1)
+             (= (position 1 v) 77)
+             (= (position 1 v :from-end t) 999)
+             (= (position 1 v :start 78) 500)
+             (= (position 1 v :end 500 :from-end t) 77)
+             (null (position 1 v :start 501 :end 999))
+             (= (position 0 v :start 77) 78)
+             (eql (find 1 v :start 100) 1)
+             (null (find 1 v :start 100 :end 200)))))
+
+(test bit-vector-fill-equal-1
+      (let ((a (make-array 200 :element-type 'bit :initial-element 0))
+            (b (make-array 200 :element-type 'bit :initial-element 0)))
+        (fill a 1 :start 5 :end 150)
+        (loop for i from 5 below 150 do (setf (sbit b i) 1))
+        (and (equal a b)
+             (= (count 1 a) 145)
+             (= (sbit a 4) 0)
+             (= (sbit a 150) 0)
+             (progn (setf (sbit b 149) 0) (not (equal a b))))))
@@ -106,3 +106,13 @@
 
 (test test-char-17 (char/= #\a #\b #\c #\d))
 (test test-char-18 (let ()(char/= #\a #\b #\c #\d)))
+
+(test char-nary-1
+      (and (char< #\a #\b #\c #\d)
+           (not (char< #\a #\c #\b))
+           (char/= #\a #\b #\c #\d #\e)
+           (not (char/= #\a #\b #\c #\d #\a))
+           (char= #\x #\x #\x)
+           (char-equal #\a #\A #\a)
+           (not (char-not-equal #\a #\b #\A))
+           (char-lessp #\a #\B #\c)))
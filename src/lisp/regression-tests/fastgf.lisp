@@ -5,3 +5,130 @@
 (defmethod fgf-foo ((x symbol)) :symbol)
 (test dispatch-symbol (eq (fgf-foo :yadda) :symbol))
 (test-expect-error dispatch-no-applicable-method (fgf-foo 1.2) :description "This should not dispatch")
+
+(defgeneric fgf-tiered (x))
+(defmethod fgf-tiered ((x integer)) :integer)
+(defmethod fgf-tiered ((x string)) :string)
+(defmethod fgf-tiered ((x (eql :key))) :key)
+(test dispatch-interpreted-then-compiled
+      (let ((clos:*fastgf-promotion-threshold* 8)
+            (clos:*fastgf-compile-in-background* nil))
+        (and (loop repeat 20
+                   always (and (eq (fgf-tiered 1) :integer)
+                               (eq (fgf-tiered "x") :string)
+                               (eq (fgf-tiered :key) :key)))
+             (eq (clos:get-funcallable-instance-function #'fgf-tiered) t))))
+
+#+threads
+(progn
+  (defgeneric fgf-background (x))
+  (defmethod fgf-background ((x integer)) :integer)
+  (defmethod fgf-background ((x cons)) :cons)
+  (test dispatch-compiled-in-background
+        (let ((clos:*fastgf-promotion-threshold* 8)
+              (clos:*fastgf-compile-in-background* t))
+          (and (loop repeat 20
+                     always (and (eq (fgf-background 1) :integer)
+                                 (eq (fgf-background '(1)) :cons)))
+               (loop repeat 200
+                     when (eq (clos:get-funcallable-instance-function #'fgf-background) t)
+                       return t
+                     do (sleep 0.05))
+               (eq (fgf-background 2) :integer)))))
+
+(defgeneric fgf-saved (x))
+(defmethod fgf-saved ((x integer)) :integer)
+(defmethod fgf-saved ((x string)) :string)
+(test save-and-load-call-histories
+      (let ((file (format nil "/tmp/clasp-regression-call-histories-~d-~d.lisp"
+                          (core:getpid) (get-universal-time))))
+        (unwind-protect
+             (progn
+               (fgf-saved 1)
+               (fgf-saved "x")
+               (clos:save-call-histories file)
+               (clos::erase-generic-function-call-history #'fgf-saved)
+               (clos::invalidate-discriminating-function #'fgf-saved)
+               (and (plusp (clos:load-call-histories file :compile nil))
+                    (= (length (clos:generic-function-call-history #'fgf-saved)) 2)
+                    (eq (fgf-saved 2) :integer)
+                    (eq (fgf-saved "y") :string)))
+          (when (probe-file file) (delete-file file)))))
+
+;;; Generic functions satiated from a file are found by the next save and
+;;; lose their entries when a class in them is redefined. A fresh generic
+;;; function stands in for one in an image that never called it.
+(defun saved-call-history-names (file)
+  (with-open-file (stream file)
+    (with-standard-io-syntax
+      (let ((*package* (find-package "KEYWORD"))
+            (*read-eval* nil))
+        (loop for form = (read stream nil stream)
+              until (eq form stream)
+              collect (clos::restored-function-name (first form)))))))
+
+(defun restore-fresh-generic-function (name defmethod-form file)
+  (clos::erase-generic-function-call-history (fdefinition name))
+  (fmakunbound name)
+  (eval `(defgeneric ,name (x)))
+  (eval defmethod-form)
+  (clos:load-call-histories file :compile nil)
+  (fdefinition name))
+
+(defclass fgf-restored-class () ())
+(defgeneric fgf-restored (x))
+(defmethod fgf-restored ((x fgf-restored-class)) :restored)
+(test save-load-save-call-histories
+      (let ((file1 (format nil "/tmp/clasp-regression-call-histories-~d-~d-1.lisp"
+                           (core:getpid) (get-universal-time)))
+            (file2 (format nil "/tmp/clasp-regression-call-histories-~d-~d-2.lisp"
+                           (core:getpid) (get-universal-time))))
+        (unwind-protect
+             (progn
+               (fgf-restored (make-instance 'fgf-restored-class))
+               (clos:save-call-histories file1)
+               (let ((gf (restore-fresh-generic-function
+                          'fgf-restored
+                          '(defmethod fgf-restored ((x fgf-restored-class)) :restored)
+                          file1)))
+                 (clos:save-call-histories file2)
+                 (and (= (length (clos:generic-function-call-history gf)) 1)
+                      (member 'fgf-restored (saved-call-history-names file2) :test #'equal)
+                      (eq (fgf-restored (make-instance 'fgf-restored-class)) :restored))))
+          (when (probe-file file1) (delete-file file1))
+          (when (probe-file file2) (delete-file file2)))))
+
+(defclass fgf-redefined-class () ())
+(defgeneric fgf-redefined (x))
+(defmethod fgf-redefined ((x fgf-redefined-class)) :redefined)
+(test load-call-histories-class-redefinition
+      (let ((file (format nil "/tmp/clasp-regression-call-histories-~d-~d-3.lisp"
+                          (core:getpid) (get-universal-time))))
+        (unwind-protect
+             (progn
+               (fgf-redefined (make-instance 'fgf-redefined-class))
+               (clos:save-call-histories file)
+               (let ((gf (restore-fresh-generic-function
+                          'fgf-redefined
+                          '(defmethod fgf-redefined ((x fgf-redefined-class)) :redefined)
+                          file)))
+                 (and (= (length (clos:generic-function-call-history gf)) 1)
+                      (progn
+                        (eval '(defclass fgf-redefined-class () ((slot :initform 1))))
+                        (null (clos:generic-function-call-history gf)))
+                      (eq (fgf-redefined (make-instance 'fgf-redefined-class)) :redefined))))
+          (when (probe-file file) (delete-file file)))))
+
+(defgeneric fgf-batch-a (x))
+(defmethod fgf-batch-a ((x integer)) :a)
+(defgeneric fgf-batch-b (x))
+(defmethod fgf-batch-b ((x integer)) :b)
+(test dispatchers-compiled-in-one-module
+      (let ((clos:*fastgf-promotion-threshold* 1000))
+        (fgf-batch-a 1)
+        (fgf-batch-b 1)
+        (and (= (clos::compile-and-install-dispatchers (list #'fgf-batch-a #'fgf-batch-b)) 2)
+             (eq (clos:get-funcallable-instance-function #'fgf-batch-a) t)
+             (eq (clos:get-funcallable-instance-function #'fgf-batch-b) t)
+             (eq (fgf-batch-a 2) :a)
+             (eq (fgf-batch-b 2) :b))))
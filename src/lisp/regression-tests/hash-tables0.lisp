@@ -24,3 +24,103 @@
                      (setf (gethash '#:a ht1) 42)
                      (setf (gethash '#:a ht2) 41)
                      (not (equalp ht1 ht2))))
+
+;;; Open addressing - growth, tombstones and reuse of deleted entries
+(test hash-table-grow-remhash
+      (let ((ht (make-hash-table :test #'eql)))
+        (dotimes (i 1000) (setf (gethash i ht) (* i i)))
+        (dotimes (i 1000) (when (evenp i) (remhash i ht)))
+        (dotimes (i 500) (setf (gethash (+ 1000 i) ht) i))
+        (and (= (hash-table-count ht) 1000)
+             (null (gethash 10 ht))
+             (= (gethash 11 ht) 121)
+             (= (gethash 1499 ht) 499)
+             (let ((sum 0))
+               (maphash (lambda (k v) (declare (ignore k)) (incf sum v)) ht)
+               (= sum (+ (loop for i from 1 below 1000 by 2 sum (* i i))
+                         (loop for i below 500 sum i)))))))
+
+(test hash-table-churn
+      (let ((ht (make-hash-table :test #'equal)))
+        ;; Repeatedly adding and removing keys must not fill the table with tombstones
+        (dotimes (i 10000)
+          (setf (gethash (format nil "key~a" i) ht) i)
+          (remhash (format nil "key~a" i) ht))
+        (setf (gethash "last" ht) t)
+        (and (= (hash-table-count ht) 1)
+             (gethash "last" ht)
+             (null (gethash "key9999" ht)))))
+
+(test hash-table-iterator-1
+      (let ((ht (make-hash-table :test #'equalp))
+            (seen nil))
+        (setf (gethash "A" ht) 1
+              (gethash #(1 2) ht) 2
+              (gethash 3.0 ht) 3)
+        (remhash #(1 2) ht)
+        (with-hash-table-iterator (next ht)
+          (loop (multiple-value-bind (more key value) (next)
+                  (unless more (return))
+                  (push (cons key value) seen))))
+        (and (= (length seen) 2)
+             (= (gethash "a" ht) 1)
+             (= (gethash 3 ht) 3)
+             (equal (sort (mapcar #'cdr seen) #'<) '(1 3)))))
+
+;;; Readers of a thread-safe table take no lock - they must never miss a key
+;;; that stays in the table while a writer grows and rehashes it
+#+threads
+(test hash-table-lock-free-readers
+      (let* ((ht (make-hash-table :test #'eql :thread-safe t))
+             (misses 0)
+             (reader (progn
+                       (dotimes (i 100) (setf (gethash i ht) i))
+                       (mp:process-run-function
+                        nil
+                        (lambda ()
+                          (dotimes (n 200000)
+                            (unless (eql (gethash (mod n 100) ht) (mod n 100))
+                              (incf misses))))))))
+        (loop for i from 100 below 20000
+              do (setf (gethash i ht) i)
+                 (when (evenp i) (remhash i ht)))
+        (mp:process-join reader)
+        (zerop misses)))
+
+(test hash-table-concurrency-1
+      (let ((ht (make-hash-table :test #'equal :concurrency 8))
+            (sum 0))
+        (dotimes (i 1000) (setf (gethash (list i) ht) i))
+        (dotimes (i 500) (remhash (list (* 2 i)) ht))
+        (maphash (lambda (k v) (declare (ignore k)) (incf sum v)) ht)
+        (and (= (hash-table-count ht) 500)
+             (= (gethash (list 7) ht) 7)
+             (null (nth-value 1 (gethash (list 8) ht)))
+             (= sum (loop for i from 1 below 1000 by 2 sum i))
+             (= (loop for v being the hash-values of ht count v) 500)
+             (progn (clrhash ht) (zerop (hash-table-count ht))))))
+
+#+threads
+(test hash-table-concurrency-2
+      (let* ((ht (make-hash-table :test #'eql :concurrency 4))
+             (workers (loop for w below 4
+                            collect (let ((w w))
+                                      (mp:process-run-function
+                                       nil
+                                       (lambda ()
+                                         (dotimes (i 5000)
+                                           (setf (gethash (+ (* w 5000) i) ht) w))))))))
+        (mapc #'mp:process-join workers)
+        (= (hash-table-count ht) 20000)))
+
+;;; base and character strings that are EQUAL must hash alike, at every length
+(test hash-table-string-keys-1
+      (let ((ht (make-hash-table :test #'equal)))
+        (dotimes (len 70)
+          (setf (gethash (make-string len :initial-element #\a :element-type 'base-char) ht) len))
+        (and (= (hash-table-count ht) 70)
+             (dotimes (len 70 t)
+               (unless (eql (gethash (make-string len :initial-element #\a :element-type 'character) ht) len)
+                 (return nil)))
+             (= (sxhash (make-string 40 :initial-element #\b :element-type 'base-char))
+                (sxhash (make-array 40 :initial-element #\b :element-type 'character :adjustable t))))))
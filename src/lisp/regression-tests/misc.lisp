@@ -177,4 +177,61 @@
 
 (test cl-symbols-1 (not (fboundp 'cl:reader-error)))
 
-                 
+#+(and target-os-linux address-model-64)
+(test profiling-1
+      (let ((file (format nil "/tmp/clasp-regression-profile-~d-~d.folded"
+                          (core:getpid) (get-universal-time))))
+        (unwind-protect
+             (progn
+               (ext:with-profiling (:frequency 1000 :pathname file)
+                 (let ((x 0))
+                   (dotimes (i 50000000) (setq x (logxor x i)))
+                   x))
+               (with-open-file (in file)
+                 (let ((line (read-line in nil)))
+                   (and line (digit-char-p (char line (1- (length line))))))))
+          (when (probe-file file) (delete-file file)))))
+
+(test allocation-statistics-1
+      (flet ((conses ()
+               (let ((entry (assoc "core::Cons_O" (gctools:allocation-statistics nil) :test #'string=)))
+                 (if entry (second entry) 0))))
+        (let ((before (conses)))
+          (make-list 1000)
+          (>= (- (conses) before) 1000))))
+
+(test allocation-profiling-1
+      (let ((file (format nil "/tmp/clasp-regression-allocations-~d-~d.folded"
+                          (core:getpid) (get-universal-time))))
+        (unwind-protect
+             (progn
+               (ext:with-allocation-profiling (:bytes-per-sample 4096 :pathname file)
+                 (let ((lists nil))
+                   (dotimes (i 100000) (push (make-list 10) lists))
+                   (length lists)))
+               (with-open-file (in file)
+                 (loop for line = (read-line in nil)
+                       while line
+                       thereis (search "[core::Cons_O]" line))))
+          (when (probe-file file) (delete-file file)))))
+
+(test jit-object-cache-1
+      (let ((dir (format nil "/tmp/clasp-regression-jit-cache-~d-~d/"
+                         (core:getpid) (get-universal-time)))
+            (previous (llvm-sys:jit-object-cache-statistics)))
+        (unwind-protect
+             (progn
+               (llvm-sys:jit-object-cache-configure dir)
+               (multiple-value-bind (d hits misses stores)
+                   (llvm-sys:jit-object-cache-statistics)
+                 (declare (ignore d misses))
+                 (and (= 42 (funcall (compile nil '(lambda () 42))))
+                      (multiple-value-bind (d new-hits new-misses new-stores)
+                          (llvm-sys:jit-object-cache-statistics)
+                        (declare (ignore d new-misses))
+                        (> (+ new-hits new-stores) (+ hits stores)))
+                      (directory (merge-pathnames "*.o" dir)))))
+          (llvm-sys:jit-object-cache-configure previous)
+          (ignore-errors
+           (mapc #'delete-file (directory (merge-pathnames "*.*" dir)))
+           (core:rmdir dir)))))
@@ -349,3 +349,72 @@
 
 
 
+
+(test bignum-arith-1
+      (let ((big (expt 2 100)))
+        (and (= (- (+ big 1) big) 1)
+             (typep (- (+ big most-positive-fixnum) big) 'fixnum)
+             (= (- 5 big) (- (- big 5)))
+             (= (- big most-negative-fixnum) (+ big (- most-negative-fixnum)))
+             (= (* most-positive-fixnum most-positive-fixnum) (expt most-positive-fixnum 2))
+             (= (* most-negative-fixnum -1) (1+ most-positive-fixnum))
+             (= (* big -3) (- (+ big big big)))
+             (= (* big big) (expt 2 200))
+             (= (- (* (expt 3 500) (expt 3 500)) (expt 3 1000)) 0))))
+
+(test nary-arith-1
+      (let ((mpf most-positive-fixnum))
+        (and (eql (apply #'+ '(1 2 3 4)) 10)
+             (eql (+ mpf 1 -1) mpf)
+             (= (+ mpf mpf 1/2) (+ (* 2 mpf) 1/2))
+             (eql (+ 1 2 3.0) 6.0)
+             (eql (+ -0.0) -0.0)
+             (eql (* 2 3 4) 24)
+             (= (* mpf 4 1/4) mpf)
+             (eql (- 10 1 2 3) 4)
+             (= (- most-negative-fixnum 1 1) (- most-negative-fixnum 2))
+             (eql (- 1 2 0.5) -1.5)
+             (eql (/ 60 2 3) 10)
+             (eql (/ 60 7 2) 30/7)
+             (eql (min 3 1 2) 1)
+             (eql (max 3 1 2.0 5) 5)
+             (eql (min 3 1 0.5) 0.5))))
+
+(test nary-compare-1
+      (and (< 1 2 3 (expt 2 70))
+           (not (< 1 3 2))
+           (<= 1 1 2.0 2)
+           (> 3 2 1/2 0)
+           (>= 3 3 2)
+           (= 2 2 2.0 4/2)
+           (not (= 2 2 3))
+           (/= 1 2 3 4 5)
+           (not (/= 1 2 3 4 1.0))))
+
+(test-expect-error nary-compare-2 (< 1 'a 3) :type type-error)
+
+;;; Direct calls are turned into two-arg calls by compiler macros, go
+;;; through FUNCALL and APPLY to reach the n-ary functions
+(test nary-arith-overflow-1
+      (let ((mpf most-positive-fixnum)
+            (mnf most-negative-fixnum))
+        (and (= (funcall #'* mpf mpf) (expt mpf 2))
+             (= (apply #'* (list 2 mpf 3 mpf)) (* 6 (expt mpf 2)))
+             (= (apply #'+ (make-list 5 :initial-element mpf)) (* 5 mpf))
+             (= (apply #'+ (list mpf mpf mnf mnf 1/2)) (+ (* 2 (+ mpf mnf)) 1/2))
+             (= (funcall #'- mnf mpf mpf) (- mnf (* 2 mpf)))
+             (= (funcall #'- mnf 1) (1- mnf))
+             (= (funcall #'/ mnf -1) (1+ mpf))
+             (typep (funcall #'/ mnf -1) 'bignum)
+             (eql (funcall #'/ 60 7 2) 30/7)
+             (eql (funcall #'+ -0.0) -0.0)
+             (eql (funcall #'min 3 1 0.5) 0.5)
+             (eql (apply #'max (list 3 mpf 2.0)) mpf))))
+
+(test nary-compare-3
+      (let ((mpf most-positive-fixnum))
+        (and (funcall #'< 1 2 mpf (1+ mpf))
+             (not (funcall #'< 1 3 2))
+             (funcall #'= 2 2 2.0)
+             (apply #'/= (list 1 2 3 4 5))
+             (not (apply #'/= (list 1 2 3 4 1.0))))))
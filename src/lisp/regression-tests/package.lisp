@@ -66,3 +66,41 @@
   (when (find-package "KARSTEN-NEW")
     (delete-package (find-package "KARSTEN-NEW"))))
 
+
+;;; symbol tables grow, and keep statuses through unintern and export
+(test intern-table-1
+      (let ((pkg (make-package "INTERN-TABLE-TEST" :use '("CL"))))
+        (unwind-protect
+             (and (dotimes (i 1000 t)
+                    (intern (format nil "SYM~d" i) pkg))
+                  (dotimes (i 1000 t)
+                    (unless (eq (nth-value 1 (find-symbol (format nil "SYM~d" i) pkg)) :internal)
+                      (return nil)))
+                  (unintern (find-symbol "SYM10" pkg) pkg)
+                  (null (find-symbol "SYM10" pkg))
+                  (progn (export (find-symbol "SYM11" pkg) pkg)
+                         (eq (nth-value 1 (find-symbol "SYM11" pkg)) :external))
+                  (eq (nth-value 1 (find-symbol (make-array 3 :element-type 'character
+                                                              :initial-contents "CAR"
+                                                              :adjustable t)
+                                                pkg))
+                      :inherited))
+          (delete-package pkg))))
+
+(test package-iterator-1
+      (let ((pkg (make-package "PACKAGE-ITERATOR-TEST" :use '("CL"))))
+        (unwind-protect
+             (progn
+               (intern "FOO" pkg)
+               (export (intern "BAR" pkg) pkg)
+               (let ((internal 0) (external 0) (inherited 0))
+                 (with-package-iterator (next pkg :internal :external :inherited)
+                   (loop (multiple-value-bind (more symbol access) (next)
+                           (declare (ignore symbol))
+                           (unless more (return))
+                           (ecase access
+                             (:internal (incf internal))
+                             (:external (incf external))
+                             (:inherited (incf inherited))))))
+                 (and (= internal 1) (= external 1) (= inherited 978))))
+          (delete-package pkg))))
@@ -157,3 +157,13 @@
   
 
 
+
+;;; free format floats print the shortest digits that read back the same
+(test print-float-shortest-1
+      (and (string= (prin1-to-string 0.1d0) "0.1d0")
+           (string= (prin1-to-string 1.0e23) "1.0e23")
+           (let ((*read-default-float-format* 'double-float))
+             (loop for x in (list 0.3d0 (/ 1d0 3) most-positive-double-float
+                                  least-positive-normalized-double-float
+                                  least-positive-double-float 123456.789d0)
+                   always (= x (read-from-string (prin1-to-string x)))))))
@@ -37,3 +37,54 @@
   
 
 
+(test read-syntax-table-1
+      (let ((*readtable* (copy-readtable nil)))
+        (set-macro-character #\! (lambda (stream char)
+                                   (declare (ignore char))
+                                   (list 'bang (read stream t nil t))))
+        (set-syntax-from-char #\] #\))
+        (let ((copy (copy-readtable))
+              (before (read-from-string "(a !b)")))
+          (set-syntax-from-char #\! #\a)
+          (and (equal before '(a (bang b)))
+               (eq (core:syntax-type *readtable* #\]) :terminating-macro)
+               (equal (read-from-string "!x") '!x)
+               (let ((*readtable* copy))
+                 (equal (read-from-string "!x") '(bang x)))
+               (eq (core:syntax-type *readtable* #\Space) :whitespace)
+               (eq (core:syntax-type *readtable* (code-char 955)) :constituent)))))
+
+(test read-token-scanner-1
+      (and (eql (read-from-string "-4611686018427387904") (- (expt 2 62)))
+           (eql (read-from-string "+123.") 123)
+           (eql (read-from-string "123456789012345678901234567890") 123456789012345678901234567890)
+           (let ((*read-base* 16))
+             (and (eql (read-from-string "ff") 255)
+                  (eql (read-from-string "10.") 10)))
+           (eql (read-from-string "1.5d3") 1500d0)
+           (eql (read-from-string "2.5f0") 2.5f0)
+           (eq (read-from-string "cl::car") 'car)
+           (eq (read-from-string ":test") :test)
+           (string= (symbol-name (read-from-string "\\abc")) "aBC")
+           (string= (symbol-name (read-from-string "#:|fOo|bar")) "fOoBAR")
+           (char= (read-from-string "#\\(") #\()
+           (with-input-from-string (s "(foo bar) baz 12")
+             (and (equal (read s) '(foo bar))
+                  (eq (read s) 'baz)
+                  (eql (read s) 12)
+                  (eq (read s nil :eof) :eof)))))
+
+(test read-float-1
+      (and (eql (let ((*read-default-float-format* 'double-float)) (read-from-string "1.5e3")) 1500d0)
+           (eql (read-from-string "0.1d0") (/ 1d0 10))
+           (eql (read-from-string "1.17549435f-38") least-positive-normalized-single-float)
+           (eql (read-from-string "4.9406564584124654d-324") least-positive-double-float)
+           (eql (read-from-string "123456789012345678901234567890.0d0") 1.2345678901234568d29)))
+
+(test parse-float-1
+      (and (eql (ext:parse-float "  2.5d0 ") 2.5d0)
+           (eql (ext:parse-float "2.5" :type 'double-float) 2.5d0)
+           (equal (multiple-value-list (ext:parse-float "x1.25e2y" :start 1 :junk-allowed t)) (list 125.0 7))
+           (null (ext:parse-float "abc" :junk-allowed t))))
+
+(test-expect-error parse-float-2 (ext:parse-float "1.0x") :type parse-error)
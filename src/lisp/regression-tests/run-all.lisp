@@ -32,6 +32,8 @@
 (load (compile-file "sys:regression-tests;printer01.lisp"))
 (load (compile-file "sys:regression-tests;streams01.lisp"))
 (load (compile-file "sys:regression-tests;loop.lisp"))
+#+threads
+(load (compile-file "sys:regression-tests;asdf-parallel.lisp"))
 
 (progn
   (note-test-finished)
@@ -61,3 +61,71 @@
 (test-expect-error WITH-INPUT-FROM-STRING-6 (WITH-INPUT-FROM-STRING (S "")(read-char s))
                    :type end-of-file)
 
+
+(defun buffered-fd-stream-roundtrip (buffer-size)
+  (let ((path (format nil "/tmp/clasp-regression-buffered-stream-~d-~d.txt"
+                      (core:getpid) (get-universal-time))))
+    (unwind-protect
+         (progn
+           (with-open-file (s path :direction :output :if-exists :supersede
+                                   :cstream nil :buffer-size buffer-size)
+             (write-line "hello" s)
+             (write-line "world" s))
+           (with-open-file (s path :cstream nil :buffer-size buffer-size)
+             (list (read-char s)
+                   (progn (unread-char #\h s) (file-position s))
+                   (read-line s)
+                   (listen s)
+                   (file-position s)
+                   (progn (file-position s 0) (read-line s))
+                   (read-line s)
+                   (listen s))))
+      (when (probe-file path) (delete-file path)))))
+
+(test buffered-fd-stream-1
+      (equal (buffered-fd-stream-roundtrip 4)
+             '(#\h 0 "hello" t 6 "hello" "world" nil)))
+
+(test buffered-fd-stream-2
+      (equal (buffered-fd-stream-roundtrip 0)
+             (buffered-fd-stream-roundtrip 8192)))
+
+;;; Everything the child wrote is pending in the pipe, and more than the
+;;; one character a read-char would have taken
+(test clear-input-pipe-1
+      (multiple-value-bind (error pid stream)
+          (ext:vfork-execvp '("printf" "abcdefgh") t)
+        (declare (ignore pid))
+        (and (eql error 0)
+             (unwind-protect
+                  (and (listen stream)
+                       (progn (clear-input stream)
+                              (not (listen stream))))
+               (close stream)))))
+
+(defun bulk-external-format-roundtrip (external-format text)
+  (let ((path (format nil "/tmp/clasp-regression-bulk-format-~d-~d.txt"
+                      (core:getpid) (get-universal-time))))
+    (unwind-protect
+         (progn
+           (with-open-file (s path :direction :output :if-exists :supersede
+                                   :external-format external-format :cstream nil)
+             (write-string text s)
+             (terpri s)
+             (write-sequence text s :start 1))
+           (with-open-file (s path :external-format external-format :cstream nil)
+             (let ((line (read-line s))
+                   (rest (make-string (1- (length text)))))
+               (list (string= line text)
+                     (= (read-sequence rest s) (length rest))
+                     (string= rest text :start2 1)
+                     (read-line s nil :eof)))))
+      (when (probe-file path) (delete-file path)))))
+
+(test bulk-external-format-1
+      (equal (bulk-external-format-roundtrip :latin-1 "abc def é")
+             '(t t t :eof)))
+
+(test bulk-external-format-2
+      (equal (bulk-external-format-roundtrip :utf-8 (format nil "x~ay~az" (code-char 955) (code-char 8364)))
+             '(t t t :eof)))
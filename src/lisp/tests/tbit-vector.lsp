@@ -0,0 +1,38 @@
+;;;; Bit vector throughput.
+;;;; Times the bit-array operations, COUNT and POSITION on large
+;;;; simple-bit-vectors, once word aligned and once through displaced
+;;;; vectors that start in the middle of a word.
+;;;;   (load "sys:tests;tbit-vector.lsp")
+;;;;   (tbit-vector)
+
+(defparameter *bit-vector-length* 100000000)
+
+(defun random-bit-vector (n)
+  (let ((v (make-array n :element-type 'bit)))
+    (dotimes (i n v)
+      (setf (sbit v i) (random 2)))))
+
+(defmacro timing (name bits &body body)
+  `(let ((start (get-internal-real-time)))
+     ,@body
+     (let ((elapsed (float (/ (- (get-internal-real-time) start) internal-time-units-per-second))))
+       (format t "~20a ~8,3f s ~10,2f Gbit/s~%" ,name elapsed (/ ,bits elapsed 1e9)))))
+
+(defun tbit-vector (&optional (n *bit-vector-length*))
+  (let* ((x (random-bit-vector n))
+         (y (random-bit-vector n))
+         (r (make-array n :element-type 'bit))
+         (len (- n 64))
+         (dx (make-array len :element-type 'bit :displaced-to x :displaced-index-offset 3))
+         (dy (make-array len :element-type 'bit :displaced-to y :displaced-index-offset 17))
+         (dr (make-array len :element-type 'bit :displaced-to r :displaced-index-offset 5)))
+    (format t "~&~d bits~%" n)
+    (timing "bit-and aligned" n (bit-and x y r))
+    (timing "bit-xor aligned" n (bit-xor x y r))
+    (timing "bit-and unaligned" len (bit-and dx dy dr))
+    (timing "count" n (count 1 x))
+    (fill r 0)
+    (timing "position" n (position 1 r))
+    (let ((copy (copy-seq x)))
+      (timing "equal" n (equal x copy)))
+    (timing "fill" n (fill r 1))))
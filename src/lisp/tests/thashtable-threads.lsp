@@ -0,0 +1,60 @@
+;;;; Read scaling of thread-safe hash tables.
+;;;; Every thread does the same number of GETHASH calls on one shared
+;;;; :thread-safe table; with lock free reads the wall time should stay
+;;;; flat as threads are added (up to the number of cores).
+;;;;   (load "sys:tests;thashtable-threads.lsp")
+;;;;   (thashtable-threads 16)
+
+(defparameter *ht-keys* 10000)
+(defparameter *ht-reads* 2000000)
+
+(defun make-shared-table (&key (test 'eql) (keys *ht-keys*))
+  (let ((ht (make-hash-table :test test :thread-safe t)))
+    (dotimes (i keys)
+      (setf (gethash (if (eq test 'equal) (format nil "key~a" i) i) ht) i))
+    ht))
+
+(defun read-table (ht keys reads)
+  (let ((found 0))
+    (dotimes (i reads)
+      (when (gethash (aref keys (mod i (length keys))) ht)
+        (incf found)))
+    found))
+
+(defun time-readers (ht keys nthreads &key writer)
+  (let* ((stop nil)
+         (writer-process
+           (when writer
+             (mp:process-run-function
+              nil
+              (lambda ()
+                (loop with i = 0
+                      until stop
+                      do (setf (gethash (+ *ht-keys* (mod i 1000)) ht) i)
+                         (remhash (+ *ht-keys* (mod (+ i 500) 1000)) ht)
+                         (incf i))))))
+         (start (get-internal-real-time))
+         (readers (loop repeat nthreads
+                        collect (mp:process-run-function
+                                 nil
+                                 (lambda () (read-table ht keys *ht-reads*))))))
+    (mapc #'mp:process-join readers)
+    (let ((elapsed (float (/ (- (get-internal-real-time) start) internal-time-units-per-second))))
+      (setf stop t)
+      (when writer-process (mp:process-join writer-process))
+      elapsed)))
+
+(defun thashtable-threads (&optional (max-threads 8))
+  (dolist (test '(eql equal))
+    (let* ((ht (make-shared-table :test test))
+           (keys (coerce (loop for i below *ht-keys*
+                               collect (if (eq test 'equal) (format nil "key~a" i) i))
+                         'vector)))
+      (dolist (writer '(nil t))
+        (format t "~&~a table, ~:[no writer~;one writer~], ~d reads per thread~%"
+                test writer *ht-reads*)
+        (loop for n = 1 then (* n 2)
+              while (<= n max-threads)
+              do (let ((elapsed (time-readers ht keys n :writer writer)))
+                   (format t "~4d threads ~8,3f s ~12,0f reads/s~%"
+                           n elapsed (/ (* n *ht-reads*) elapsed))))))))
@@ -0,0 +1,33 @@
+;;;; Symbol lookup throughput.
+;;;; Interns and finds every external symbol name of COMMON-LISP, both
+;;;; directly in CL and through a package that only inherits them, so the
+;;;; lookup has to walk the used-package chain.
+;;;;   (load "sys:tests;tintern.lsp")
+;;;;   (tintern)
+
+(defparameter *intern-rounds* 200)
+
+(defun cl-symbol-names ()
+  (let (names)
+    (do-external-symbols (sym "COMMON-LISP")
+      (push (symbol-name sym) names))
+    (coerce names 'vector)))
+
+(defun time-lookups (fn names package rounds)
+  (let ((start (get-internal-real-time)))
+    (dotimes (r rounds)
+      (loop for name across names
+            do (funcall fn name package)))
+    (float (/ (- (get-internal-real-time) start) internal-time-units-per-second))))
+
+(defun tintern (&optional (rounds *intern-rounds*))
+  (let* ((names (cl-symbol-names))
+         (user (or (find-package "TINTERN-USER")
+                   (make-package "TINTERN-USER" :use '("COMMON-LISP"))))
+         (ops (* rounds (length names))))
+    (format t "~&~d names, ~d rounds~%" (length names) rounds)
+    (dolist (package (list (find-package "COMMON-LISP") user))
+      (dolist (fn '(intern find-symbol))
+        (let ((elapsed (time-lookups (fdefinition fn) names package rounds)))
+          (format t "~12a in ~12a ~8,3f s ~12,0f ops/s~%"
+                  fn (package-name package) elapsed (/ ops elapsed)))))))
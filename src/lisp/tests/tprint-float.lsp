@@ -0,0 +1,21 @@
+;;;; Float printing throughput.
+;;;; PRIN1s *float-count* pseudo random doubles to a null stream, that
+;;;; is all free format output and so all shortest digit generation.
+;;;;   (load "sys:tests;tprint-float.lsp")
+;;;;   (tprint-float)
+
+(defparameter *float-count* 10000000)
+
+(defun tprint-float (&optional (count *float-count*))
+  (let ((state (make-random-state nil))
+        (out (make-broadcast-stream)))
+    (dolist (kind '(:uniform :wide))
+      (let ((start (get-internal-real-time)))
+        (dotimes (i count)
+          (prin1 (if (eq kind :uniform)
+                     (random 1.0d6 state)
+                     (scale-float (+ 1d0 (random 1d0 state)) (- (random 2000 state) 1000)))
+                 out))
+        (let ((elapsed (float (/ (- (get-internal-real-time) start) internal-time-units-per-second))))
+          (format t "~&~8a ~d doubles ~8,3f s ~12,0f floats/s~%"
+                  kind count elapsed (/ count elapsed)))))))
@@ -76,9 +76,18 @@ THE SOFTWARE.
 #include "llvm/IR/AssemblyAnnotationWriter.h" // will be llvm/IR
 //#include <llvm/IR/PrintModulePass.h> // will be llvm/IR  was llvm/Assembly
 
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/Path.h>
+
 #if defined(USE_LIBUNWIND) && defined(_TARGET_OS_LINUX)
 #include <libunwind.h>
 #endif
+#include <dirent.h>
+#include <sys/stat.h>
+#include <utime.h>
+#include <unistd.h>
 
 #include <clasp/core/foundation.h>
 #include <clasp/core/common.h>
@@ -3506,6 +3515,196 @@ class ClaspSectionMemoryManager : public SectionMemoryManager {
 
 
 
+/*! An on-disk cache of the object files the JIT produces.
+    SimpleCompiler asks getObject before it runs codegen on an (already optimized)
+    module and calls notifyObjectCompiled afterwards.  Entries are keyed by the
+    SHA1 of the module bitcode, the target triple/cpu/features and the clasp build,
+    so identical IR compiled by any clasp process with the same build is reused.
+    Files are written to a temporary name and rename(2)'d into place so concurrent
+    writers never expose a partial object.  A hit touches the file's mtime and when
+    the directory grows past its size cap the least recently used entries are removed.
+    The cache is off until a directory is configured, either with the environment
+    variable CLASP_JIT_OBJECT_CACHE or with llvm-sys:jit-object-cache-configure. */
+class ClaspObjectCache : public llvm::ObjectCache {
+  mp::Mutex _Mutex;
+  bool _Initialized;
+  std::string _Directory;
+  std::string _BuildKey;
+  size_t _MaxBytes;
+  size_t _ApproximateBytes;
+  size_t _TempCounter;
+  std::map<const llvm::Module*,std::string> _PendingKeys;
+public:
+  size_t _Hits;
+  size_t _Misses;
+  size_t _Stores;
+public:
+  ClaspObjectCache() : _Initialized(false), _MaxBytes(0), _ApproximateBytes(0), _TempCounter(0),
+                       _Hits(0), _Misses(0), _Stores(0) {};
+
+  /*! Called by every ClaspJIT_O; the first one picks up the environment. */
+  void initialize(const llvm::TargetMachine& TM) {
+    WITH_READ_WRITE_LOCK(this->_Mutex);
+    if (this->_Initialized) return;
+    this->_Initialized = true;
+    stringstream ss;
+    ss << TM.getTargetTriple().str() << "/" << TM.getTargetCPU().str() << "/" << TM.getTargetFeatureString().str()
+       << "/" << CLASP_VERSION << "/" << CLASP_GIT_COMMIT << "/" << LLVM_VERSION_STRING;
+    this->_BuildKey = ss.str();
+    const char* dir = getenv("CLASP_JIT_OBJECT_CACHE");
+    if (dir && dir[0] != '\0') {
+      size_t max_bytes = 256*1024*1024;
+      const char* size = getenv("CLASP_JIT_OBJECT_CACHE_MBYTES");
+      if (size) max_bytes = strtoul(size,NULL,10)*1024*1024;
+      this->configure_locked(dir,max_bytes);
+    }
+  }
+
+  void configure(const std::string& directory, size_t max_bytes) {
+    WITH_READ_WRITE_LOCK(this->_Mutex);
+    this->configure_locked(directory,max_bytes);
+  }
+
+  std::string directory() {
+    WITH_READ_WRITE_LOCK(this->_Mutex);
+    return this->_Directory;
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* M) override {
+    WITH_READ_WRITE_LOCK(this->_Mutex);
+    if (this->_Directory.empty()) return nullptr;
+    std::string key = this->module_key(M);
+    std::string path = this->entry_path(key);
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer = llvm::MemoryBuffer::getFile(path,-1,false);
+    if (!buffer) {
+      this->_PendingKeys[M] = key;
+      ++this->_Misses;
+      return nullptr;
+    }
+    this->_PendingKeys.erase(M);
+    utime(path.c_str(),NULL);
+    ++this->_Hits;
+    return std::move(*buffer);
+  }
+
+  void notifyObjectCompiled(const llvm::Module* M, llvm::MemoryBufferRef Obj) override {
+    WITH_READ_WRITE_LOCK(this->_Mutex);
+    auto it = this->_PendingKeys.find(M);
+    if (it == this->_PendingKeys.end()) return;
+    std::string key = it->second;
+    this->_PendingKeys.erase(it);
+    if (this->_Directory.empty()) return;
+    std::string path = this->entry_path(key);
+    stringstream tmp;
+    tmp << path << ".tmp." << getpid() << "." << this->_TempCounter++;
+    std::string tmp_path = tmp.str();
+    FILE* fout = fopen(tmp_path.c_str(),"w");
+    if (!fout) return;
+    size_t size = Obj.getBufferSize();
+    bool ok = (fwrite(Obj.getBufferStart(),1,size,fout) == size);
+    ok = (fclose(fout) == 0) && ok;
+    if (!ok || rename(tmp_path.c_str(),path.c_str()) != 0) {
+      unlink(tmp_path.c_str());
+      return;
+    }
+    ++this->_Stores;
+    this->_ApproximateBytes += size;
+    if (this->_ApproximateBytes > this->_MaxBytes) this->evict();
+  }
+
+private:
+  void configure_locked(const std::string& directory, size_t max_bytes) {
+    this->_PendingKeys.clear();
+    this->_MaxBytes = max_bytes;
+    this->_Directory = "";
+    if (directory.empty()) return;
+    if (llvm::sys::fs::create_directories(directory)) {
+      fprintf(stderr,"%s:%d Could not create JIT object cache directory %s - the cache is disabled\n", __FILE__, __LINE__, directory.c_str());
+      return;
+    }
+    this->_Directory = directory;
+    this->evict();
+  }
+
+  std::string entry_path(const std::string& key) {
+    return this->_Directory + "/" + key + ".o";
+  }
+
+  std::string module_key(const llvm::Module* M) {
+    llvm::SmallString<0> bitcode;
+    llvm::raw_svector_ostream stream(bitcode);
+    llvm::WriteBitcodeToFile(M,stream);
+    llvm::SHA1 hasher;
+    hasher.update(this->_BuildKey);
+    hasher.update(llvm::StringRef(bitcode.data(),bitcode.size()));
+    llvm::StringRef digest = hasher.result();
+    static const char* hex = "0123456789abcdef";
+    std::string key;
+    for ( unsigned char c : digest ) {
+      key.push_back(hex[c>>4]);
+      key.push_back(hex[c&15]);
+    }
+    return key;
+  }
+
+  /*! Scan the directory and delete the least recently used entries until the
+      cache is below 3/4 of its cap.  Temporary files left behind by processes
+      that died in the middle of a write are removed once they are an hour old. */
+  void evict() {
+    DIR* dir = opendir(this->_Directory.c_str());
+    if (!dir) return;
+    std::vector<std::pair<time_t,std::pair<std::string,size_t>>> entries;
+    size_t total = 0;
+    time_t now = time(NULL);
+    while (struct dirent* ent = readdir(dir)) {
+      std::string name(ent->d_name);
+      std::string path = this->_Directory + "/" + name;
+      struct stat st;
+      if (stat(path.c_str(),&st) != 0 || !S_ISREG(st.st_mode)) continue;
+      if (name.find(".tmp.") != std::string::npos) {
+        if (now - st.st_mtime > 3600) unlink(path.c_str());
+        continue;
+      }
+      if (name.size() < 2 || name.compare(name.size()-2,2,".o") != 0) continue;
+      entries.push_back(std::make_pair(st.st_mtime,std::make_pair(path,(size_t)st.st_size)));
+      total += st.st_size;
+    }
+    closedir(dir);
+    if (total > this->_MaxBytes) {
+      std::sort(entries.begin(),entries.end());
+      size_t target = this->_MaxBytes/4*3;
+      for ( auto& entry : entries ) {
+        if (total <= target) break;
+        if (unlink(entry.second.first.c_str()) == 0) total -= entry.second.second;
+      }
+    }
+    this->_ApproximateBytes = total;
+  }
+};
+
+ClaspObjectCache global_jit_object_cache;
+
+CL_LAMBDA(directory &optional (max-bytes 268435456));
+CL_DOCSTRING("Cache the object files the JIT produces in DIRECTORY (a string or pathname) and reuse them for identical modules. Entries are evicted least recently used first when the directory holds more than MAX-BYTES. A DIRECTORY of NIL turns the cache off.");
+CL_DEFUN void llvm_sys__jit_object_cache_configure(core::T_sp directory, size_t max_bytes) {
+  std::string dir;
+  if (directory.notnilp()) {
+    core::T_sp namestring = core::cl__namestring(core::cl__translate_logical_pathname(directory));
+    dir = gc::As<core::String_sp>(namestring)->get_std_string();
+  }
+  global_jit_object_cache.configure(dir,max_bytes);
+}
+
+CL_DOCSTRING("Return the directory of the JIT object cache (or NIL if it is off) and, as further values, the number of hits, misses and stores.");
+CL_DEFUN core::T_mv llvm_sys__jit_object_cache_statistics() {
+  std::string dir = global_jit_object_cache.directory();
+  core::T_sp tdir = dir.empty() ? core::T_sp(_Nil<core::T_O>()) : core::T_sp(core::SimpleBaseString_O::make(dir));
+  return Values(tdir,
+                core::make_fixnum((Fixnum)global_jit_object_cache._Hits),
+                core::make_fixnum((Fixnum)global_jit_object_cache._Misses),
+                core::make_fixnum((Fixnum)global_jit_object_cache._Stores));
+}
+
 ClaspJIT_O::ClaspJIT_O() : TM(EngineBuilder().selectTarget()),
                            DL(TM->createDataLayout()),
                            ObjectLayer([]() { return std::make_shared<ClaspSectionMemoryManager>(); },
@@ -3513,9 +3712,9 @@ ClaspJIT_O::ClaspJIT_O() : TM(EngineBuilder().selectTarget()),
                                               const RTDyldObjectLinkingLayerBase::ObjectPtr& Obj,
                                               const RuntimeDyld::LoadedObjectInfo &Info) {
                                          this->GDBEventListener->NotifyObjectEmitted(*(Obj->getBinary()), Info);
-                                         save_symbol_info(*(Obj->getBinary()), Info);
+                                         save_symbol_info(*(Obj->getBinary()), Info, (void*)&*H);
                                        }),
-                           CompileLayer(ObjectLayer, SimpleCompiler(*TM)),
+                           CompileLayer(ObjectLayer, SimpleCompiler(*TM,&global_jit_object_cache)),
                            OptimizeLayer(CompileLayer,
                                          [this](std::shared_ptr<Module> M) {
                                            return optimizeModule(std::move(M));
@@ -3524,6 +3723,7 @@ ClaspJIT_O::ClaspJIT_O() : TM(EngineBuilder().selectTarget()),
                            ModuleHandles(_Nil<core::T_O>())
 {
   llvm::sys::DynamicLibrary::LoadLibraryPermanently(nullptr);
+  global_jit_object_cache.initialize(*TM);
 }
 
 void register_symbol_with_libunwind(const std::string& name, uint64_t start, size_t size) {
@@ -3544,8 +3744,18 @@ void register_symbol_with_libunwind(const std::string& name, uint64_t start, siz
 #endif
 }
 
-void save_symbol_info(const llvm::object::ObjectFile& object_file, const llvm::RuntimeDyld::LoadedObjectInfo& loaded_object_info)
+SYMBOL_EXPORT_SC_(KeywordPkg, jit_log_symbols);
+
+/*! Record the extent of every symbol in a freshly emitted object file.
+    The symbols go into the native interval index in debugger.cc, keyed by
+    the object layer handle (owner) so that removeModule can drop them again.
+    Lisp is only called back when :jit-log-symbols is on *features*. */
+void save_symbol_info(const llvm::object::ObjectFile& object_file, const llvm::RuntimeDyld::LoadedObjectInfo& loaded_object_info, void* owner)
 {
+  bool log_symbols = (!comp::_sym_jit_register_symbol.unboundp())
+    && comp::_sym_jit_register_symbol->fboundp()
+    && cl::_sym_STARfeaturesSTAR->symbolValue().consp()
+    && gc::As<core::Cons_sp>(cl::_sym_STARfeaturesSTAR->symbolValue())->memberEq(kw::_sym_jit_log_symbols).notnilp();
   std::vector< std::pair< llvm::object::SymbolRef, uint64_t > > symbol_sizes = llvm::object::computeSymbolSizes(object_file);
   for ( auto p : symbol_sizes ) {
     llvm::object::SymbolRef symbol = p.first;
@@ -3560,13 +3770,11 @@ void save_symbol_info(const llvm::object::ObjectFile& object_file, const llvm::R
         const llvm::object::SectionRef& section_ref = **expected_section_iterator;
         uint64_t section_address = loaded_object_info.getSectionLoadAddress(section_ref);
         if (((char*)section_address+address) != NULL ) {
-          core::register_jitted_object(name,section_address+address,size);
-          core::Cons_sp symbol_info = core::Cons_O::createList(core::make_fixnum((Fixnum)size),core::Pointer_O::create((void*)((char*)section_address+address)));
+          core::register_jitted_object(name,section_address+address,size,owner);
           register_symbol_with_libunwind(name,section_address+address,size);
-          if ((!comp::_sym_jit_register_symbol.unboundp()) && comp::_sym_jit_register_symbol->fboundp()) {
+          if (log_symbols) {
+            core::Cons_sp symbol_info = core::Cons_O::createList(core::make_fixnum((Fixnum)size),core::Pointer_O::create((void*)((char*)section_address+address)));
             core::eval::funcall(comp::_sym_jit_register_symbol,core::SimpleBaseString_O::make(name),symbol_info);
-//            printf("%s:%d  Registering symbol -> %s : %s\n", __FILE__, __LINE__, name.c_str(), _rep_(symbol_info).c_str() );
-//        gc::As<core::HashTableEqual_sp>(comp::_sym_STARjit_saved_symbol_infoSTAR->symbolValue())->hash_table_setf_gethash(core::SimpleBaseString_O::make(name),symbol_info);
           }
         }
       }
@@ -3575,27 +3783,28 @@ void save_symbol_info(const llvm::object::ObjectFile& object_file, const llvm::R
 }
 
 
+CL_LAMBDA(ptr);
+CL_DOCSTRING("Return (name . (size pointer)) for the JITted symbol that contains ptr or NIL.");
 CL_DEFUN core::T_sp llvm_sys__lookup_jit_symbol_info(void* ptr) {
-  core::HashTableEqual_sp ht = gc::As<core::HashTableEqual_sp>(comp::_sym_STARjit_saved_symbol_infoSTAR->symbolValue());
-  core::T_sp result = _Nil<core::T_O>();
-  ht->map_while_true([ptr,&result] (core::T_sp key, core::T_sp value) -> bool {
-      if (value.consp()) {
-        core::T_sp address = value.unsafe_cons()->ocadr();
-        core::T_sp size = value.unsafe_cons()->ocar();
-        char* start = (char*)(gc::As<core::Pointer_sp>(address)->ptr());
-        if (size.fixnump()) {
-          char* end = start+size.unsafe_fixnum();
-//          printf("%s:%d  Comparing ptr@%p to %p - %p\n", __FILE__, __LINE__, ptr, start, end);
-          if (start<=(char*)ptr && ptr<end) {
-            result = core::Cons_O::create(key,value);
-//            printf("Found a match\n");
-            return false;
-          }
-        }
-      }
-      return true;
-    });
-  return result;
+  std::string name;
+  uintptr_t start;
+  size_t size;
+  if (core::lookup_jitted_object((uintptr_t)ptr,name,start,size)) {
+    return core::Cons_O::create(core::SimpleBaseString_O::make(name),
+                                core::Cons_O::createList(core::make_fixnum((Fixnum)size),core::Pointer_O::create((void*)start)));
+  }
+  return _Nil<core::T_O>();
+}
+
+CL_LAMBDA(name);
+CL_DOCSTRING("Return (size pointer) for the JITted symbol with the given name or NIL.");
+CL_DEFUN core::T_sp llvm_sys__jit_symbol_info(core::String_sp name) {
+  uintptr_t start;
+  size_t size;
+  if (core::lookup_jitted_object_named(name->get_std_string(),start,size)) {
+    return core::Cons_O::createList(core::make_fixnum((Fixnum)size),core::Pointer_O::create((void*)start));
+  }
+  return _Nil<core::T_O>();
 }
           
 
@@ -3690,6 +3899,7 @@ CL_DEFMETHOD core::Pointer_sp ClaspJIT_O::findSymbolIn(ModuleHandle_sp handle, c
 CL_LISPIFY_NAME("CLASP-JIT-REMOVE-MODULE");
 CL_DEFMETHOD bool ClaspJIT_O::removeModule(ModuleHandle_sp H) {
   H->shutdown_module();
+  core::unregister_jitted_objects((void*)&*(H->_Handle));
   auto ret = OptimizeLayer.removeModule(H->_Handle);
   return true;
 }
@@ -71,6 +71,7 @@ SRC_CORE_FILES = \
 #        'sexpSaveArchive',
         'readtable',
         'float_to_digits',
+        'parse_float',
         'pathname',
         'commandLineOptions',
         'exceptions',
@@ -113,6 +114,7 @@ SRC_CORE_FILES = \
         'loadTimeValues',
 #        'reader',
         'lightProfiler',
+        'sampleProfiler',
         'fileSystem',
         'intArray',
         'posixTime',